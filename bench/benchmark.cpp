@@ -0,0 +1,443 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Benchmark driver for all four algorithms. Every workload is generated from a fixed seed,
+// run several times, and reported as one JSON document on stdout (latency percentiles,
+// throughput and peak RSS) so runs can be diffed to catch regressions.
+//
+// Build: g++ -std=c++20 -O2 -pthread -o bench/benchmark bench/benchmark.cpp huffman/huffman_lib.cpp
+//        quicksort/quicksort_hoare_lib.cpp djikstras_algorithm/dijkstras_algo_lib.cpp prims_algorithm/prims_Algorithm_lib.cpp
+// Usage: bench/benchmark [--seed N] [--scale F] [--reps N] [--filter substring]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+#include "../huffman/huffman.h"
+#include "../quicksort/quicksort_hoare.h"
+#include "../djikstras_algorithm/dijkstras_algo.h"
+#include "../prims_algorithm/prims_Algorithm.h"
+
+struct BenchmarkOptions
+{
+    unsigned seed = 42;
+    double scale = 1.0;
+    int reps = 7;
+    std::string filter;
+};
+
+// Peak resident set size of the process so far, in kilobytes
+long peak_rss_kb()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// A "VmRSS:" style field of /proc/self/status in kilobytes, or -1 when it cannot be read
+long proc_status_kb(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, field.size(), field) == 0)
+            return std::atol(line.c_str() + field.size());
+    }
+    return -1;
+}
+
+// Reset the kernel's resident set high-water mark (VmHWM) to the current RSS so the next
+// peak reading covers one workload only; false where /proc/self/clear_refs is unavailable
+bool reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5" << std::flush;
+    return bool(clear_refs) && proc_status_kb("VmHWM:") >= 0;
+}
+
+// Nearest-rank percentile of an already sorted sample
+double percentile(const std::vector<double>& sorted, double fraction)
+{
+    size_t rank = size_t(std::ceil(fraction * sorted.size()));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+// Runs workloads and accumulates their results as JSON objects
+class BenchmarkRunner
+{
+    private:
+        BenchmarkOptions options;
+        std::vector<std::string> results;
+        long process_peak_kb = 0;   // resetting VmHWM also lowers ru_maxrss, so the overall peak is kept here
+
+    public:
+        BenchmarkRunner(const BenchmarkOptions& opts) : options(opts)
+        {}
+
+        bool selected(const std::string& name) const
+        {
+            return options.filter.empty() || name.find(options.filter) != std::string::npos;
+        }
+
+        // setup() prepares fresh input before each repetition and is not timed; run() is timed
+        // and returns a checksum that is reported so a wrong answer shows up as a diff.
+        // items counts what one repetition processes, in item_unit, for the throughput figure.
+        void run(const std::string& algorithm, const std::string& workload, long long items, const std::string& item_unit,
+                 const std::function<void()>& setup, const std::function<long long()>& body)
+        {
+            std::string name = algorithm + "/" + workload;
+            if (!selected(name))
+                return;
+
+            // Memory is measured per workload: the high-water mark is reset first where the kernel
+            // allows it, otherwise growth of the process-wide peak during this workload is reported
+            bool per_workload_peak = reset_peak_rss();
+            long rss_before = per_workload_peak ? proc_status_kb("VmRSS:") : peak_rss_kb();
+
+            std::vector<double> latencies;
+            long long checksum = 0;
+            for (int rep = 0; rep < options.reps; ++rep)
+            {
+                setup();
+                auto begin = std::chrono::steady_clock::now();
+                checksum = body();
+                auto end = std::chrono::steady_clock::now();
+                latencies.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+            }
+
+            long rss_peak = per_workload_peak ? proc_status_kb("VmHWM:") : peak_rss_kb();
+            process_peak_kb = std::max(process_peak_kb, rss_peak);
+
+            std::sort(latencies.begin(), latencies.end());
+            double mean = 0;
+            for (double latency : latencies)
+                mean += latency / latencies.size();
+            double median = percentile(latencies, 0.5);
+
+            std::string json = "    {\"name\": \"" + name + "\", \"algorithm\": \"" + algorithm + "\", \"workload\": \"" + workload + "\""
+                + ", \"items\": " + std::to_string(items)
+                + ", \"item_unit\": \"" + item_unit + "\""
+                + ", \"reps\": " + std::to_string(options.reps)
+                + ", \"checksum\": " + std::to_string(checksum)
+                + ", \"latency_ns\": {\"min\": " + std::to_string(latencies.front())
+                + ", \"p50\": " + std::to_string(median)
+                + ", \"p90\": " + std::to_string(percentile(latencies, 0.9))
+                + ", \"p99\": " + std::to_string(percentile(latencies, 0.99))
+                + ", \"max\": " + std::to_string(latencies.back())
+                + ", \"mean\": " + std::to_string(mean) + "}"
+                + ", \"throughput_items_per_s\": " + std::to_string(items / (median * 1e-9))
+                + ", \"rss_before_kb\": " + std::to_string(rss_before)
+                + ", \"peak_rss_kb\": " + std::to_string(rss_peak)
+                + ", \"peak_rss_growth_kb\": " + std::to_string(std::max(0L, rss_peak - rss_before))
+                + ", \"peak_rss_scope\": \"" + (per_workload_peak ? "workload" : "process") + "\"}";
+            results.push_back(json);
+            std::cerr << name << ": p50 " << median / 1e6 << " ms" << std::endl;
+        }
+
+        void print() const
+        {
+            std::cout << "{\n  \"seed\": " << options.seed
+                      << ",\n  \"scale\": " << options.scale
+                      << ",\n  \"reps\": " << options.reps
+                      << ",\n  \"peak_rss_kb\": " << std::max(process_peak_kb, peak_rss_kb())
+                      << ",\n  \"results\": [\n";
+            for (size_t i = 0; i < results.size(); ++i)
+                std::cout << results[i] << (i + 1 < results.size() ? ",\n" : "\n");
+            std::cout << "  ]\n}" << std::endl;
+        }
+};
+
+// ---------------------------------------------------------------------------------------------
+// Workload generators
+// ---------------------------------------------------------------------------------------------
+
+std::vector<int> uniform_array(int n, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> distr(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    std::vector<int> arr(n);
+    for (int& value : arr)
+        value = distr(gen);
+    return arr;
+}
+
+// Ascending first half followed by a descending second half
+std::vector<int> organ_pipe_array(int n)
+{
+    std::vector<int> arr(n);
+    for (int i = 0; i < n; ++i)
+        arr[i] = (i < n / 2) ? i : n - i;
+    return arr;
+}
+
+std::vector<int> few_unique_array(int n, int distinct, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> distr(0, distinct - 1);
+    std::vector<int> arr(n);
+    for (int& value : arr)
+        value = distr(gen);
+    return arr;
+}
+
+// Symbol frequencies following Zipf's law with exponent s, scaled so the most frequent
+// symbol occurs max_frequency times, then shuffled so the input is not presorted
+std::vector<int> zipf_frequencies(int n, double s, int max_frequency, std::mt19937& gen)
+{
+    std::vector<int> frequencies(n);
+    for (int rank = 0; rank < n; ++rank)
+        frequencies[rank] = std::max(1, int(max_frequency / std::pow(rank + 1, s)));
+    std::shuffle(frequencies.begin(), frequencies.end(), gen);
+    return frequencies;
+}
+
+// A generated graph; edges are listed once and treated as directed or undirected by the caller
+struct GeneratedGraph
+{
+    int n_vertices;
+    std::vector<graph_io::EdgeRecord> edges;
+};
+
+// Uniform random endpoints plus a backbone path so every vertex is reachable from 0
+GeneratedGraph random_graph(int n, int average_degree, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> vertex_distr(0, n - 1);
+    std::uniform_int_distribution<int> weight_distr(1, 1000);
+    GeneratedGraph graph{n, {}};
+    for (int v = 1; v < n; ++v)
+        graph.edges.push_back({v - 1, v, weight_distr(gen)});
+    for (long long i = 0; i < (long long)n * average_degree; ++i)
+        graph.edges.push_back({vertex_distr(gen), vertex_distr(gen), weight_distr(gen)});
+    return graph;
+}
+
+// Road-like width x width grid with 4-neighbour links in both directions and a few dropped edges
+GeneratedGraph grid_graph(int width, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> weight_distr(10, 100);
+    std::bernoulli_distribution keep_distr(0.95);
+    GeneratedGraph graph{width * width, {}};
+    for (int r = 0; r < width; ++r)
+    {
+        for (int c = 0; c < width; ++c)
+        {
+            int v = r * width + c;
+            bool backbone = (r == 0);
+            if (c + 1 < width && (backbone || keep_distr(gen)))
+            {
+                int weight = weight_distr(gen);
+                graph.edges.push_back({v, v + 1, weight});
+                graph.edges.push_back({v + 1, v, weight});
+            }
+            if (r + 1 < width && (c == 0 || keep_distr(gen)))
+            {
+                int weight = weight_distr(gen);
+                graph.edges.push_back({v, v + width, weight});
+                graph.edges.push_back({v + width, v, weight});
+            }
+        }
+    }
+    return graph;
+}
+
+// Chung-Lu graph whose expected degrees follow a power law with exponent gamma, plus a backbone path
+GeneratedGraph power_law_graph(int n, int average_degree, double gamma, std::mt19937& gen)
+{
+    std::vector<double> expected_degree(n);
+    for (int v = 0; v < n; ++v)
+        expected_degree[v] = std::pow(v + 1, -1.0 / (gamma - 1));
+
+    std::discrete_distribution<int> vertex_distr(expected_degree.begin(), expected_degree.end());
+    std::uniform_int_distribution<int> weight_distr(1, 1000);
+    std::vector<int> relabel(n);
+    std::iota(relabel.begin(), relabel.end(), 0);
+    std::shuffle(relabel.begin(), relabel.end(), gen);
+
+    GeneratedGraph graph{n, {}};
+    for (int v = 1; v < n; ++v)
+        graph.edges.push_back({v - 1, v, weight_distr(gen)});
+    for (long long i = 0; i < (long long)n * average_degree / 2; ++i)
+        graph.edges.push_back({relabel[vertex_distr(gen)], relabel[vertex_distr(gen)], weight_distr(gen)});
+    return graph;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Workloads
+// ---------------------------------------------------------------------------------------------
+
+void benchmark_quicksort(BenchmarkRunner& runner, const BenchmarkOptions& options)
+{
+    std::mt19937 gen(options.seed);
+    int n = std::max(16, int(1000000 * options.scale));
+
+    std::vector<int> sorted_input = uniform_array(n, gen);
+    std::sort(sorted_input.begin(), sorted_input.end());
+    std::vector<int> reversed_input(sorted_input.rbegin(), sorted_input.rend());
+
+    std::vector<std::pair<std::string, std::vector<int>>> inputs;
+    inputs.emplace_back("uniform", uniform_array(n, gen));
+    inputs.emplace_back("sorted", std::move(sorted_input));
+    inputs.emplace_back("reversed", std::move(reversed_input));
+    inputs.emplace_back("organ_pipe", organ_pipe_array(n));
+    inputs.emplace_back("few_unique", few_unique_array(n, 16, gen));
+
+    std::vector<int> arr;
+    for (const auto& [workload, input] : inputs)
+    {
+        runner.run("quicksort", workload, n, "elements",
+            [&]() { arr = input; },
+            [&]()
+            {
+                quicksort::quickSort(arr, 0, n - 1);
+                return (long long)std::is_sorted(arr.begin(), arr.end());
+            });
+    }
+}
+
+void benchmark_huffman(BenchmarkRunner& runner, const BenchmarkOptions& options)
+{
+    std::mt19937 gen(options.seed);
+    int n = std::max(16, int(200000 * options.scale));
+
+    for (double exponent : {1.0, 1.5})
+    {
+        std::vector<int> frequencies = zipf_frequencies(n, exponent, 10000, gen);
+        std::vector<std::byte> scratch(huffman::huffman_scratch_bytes(n));
+        runner.run("huffman", "zipf_s" + std::to_string(exponent).substr(0, 3), n, "symbols",
+            []() {},
+            [&]()
+            {
+                std::pmr::monotonic_buffer_resource arena(scratch.data(), scratch.size(), std::pmr::null_memory_resource());
+                return huffman::huffman_total_bits(frequencies, &arena);
+            });
+    }
+}
+
+std::vector<std::pair<std::string, GeneratedGraph>> benchmark_graphs(const BenchmarkOptions& options)
+{
+    std::mt19937 gen(options.seed);
+    int n = std::max(16, int(200000 * options.scale));
+    int width = std::max(4, int(std::sqrt(double(n))));
+
+    std::vector<std::pair<std::string, GeneratedGraph>> graphs;
+    graphs.emplace_back("random", random_graph(n, 4, gen));
+    graphs.emplace_back("grid", grid_graph(width, gen));
+    graphs.emplace_back("power_law", power_law_graph(n, 8, 2.3, gen));
+    return graphs;
+}
+
+void benchmark_dijkstra(BenchmarkRunner& runner, const BenchmarkOptions& options, const std::vector<std::pair<std::string, GeneratedGraph>>& graphs)
+{
+    for (const auto& [workload, generated] : graphs)
+    {
+        dijkstra::Graph graph(generated.n_vertices, generated.edges);
+        std::vector<std::byte> scratch(dijkstra::dijkstra_scratch_bytes(generated.n_vertices));
+        std::mt19937 gen(options.seed);
+        std::uniform_int_distribution<int> vertex_distr(0, generated.n_vertices - 1);
+
+        // every repetition answers the same seeded batch of point-to-point queries, so the spread
+        // between repetitions is timing noise rather than how long individual queries happen to be;
+        // one query usually touches only part of the graph, so throughput is counted in queries
+        const int n_queries = 32;
+        std::vector<std::pair<int, int>> queries(n_queries);
+        for (auto& [start, end] : queries)
+        {
+            start = vertex_distr(gen);
+            end = vertex_distr(gen);
+        }
+
+        runner.run("dijkstra", workload, n_queries, "queries",
+            []() {},
+            [&]()
+            {
+                uint64_t checksum = 0;
+                for (const auto& [start, end] : queries)
+                {
+                    std::pmr::monotonic_buffer_resource arena(scratch.data(), scratch.size(), std::pmr::null_memory_resource());
+                    checksum = checksum * 31 + uint64_t(dijkstra::dijkstra_Algorithm(graph.view(), start, end, &arena));
+                }
+                return (long long)checksum;
+            });
+    }
+}
+
+void benchmark_prim(BenchmarkRunner& runner, const std::vector<std::pair<std::string, GeneratedGraph>>& graphs)
+{
+    for (const auto& [workload, generated] : graphs)
+    {
+        prims::Graph graph(generated.n_vertices, generated.edges);
+        for (auto [name, heap] : {std::pair{"prim_binary_heap", prims::HeapKind::binary}, std::pair{"prim_pairing_heap", prims::HeapKind::pairing}})
+        {
+            std::vector<std::byte> scratch(prims::prim_scratch_bytes(generated.n_vertices, heap));
+            runner.run(name, workload, generated.edges.size(), "edges",
+                []() {},
+                [&]()
+                {
+                    std::pmr::monotonic_buffer_resource arena(scratch.data(), scratch.size(), std::pmr::null_memory_resource());
+                    return prims::prim_algorithm(graph.view(), 0, heap, &arena);
+                });
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string flag = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Usage: " << argv[0] << " [--seed N] [--scale F] [--reps N] [--filter substring]" << std::endl;
+            return 1;
+        }
+
+        if (flag == "--seed")
+            options.seed = std::strtoul(argv[++i], nullptr, 10);
+        else if (flag == "--scale")
+            options.scale = std::atof(argv[++i]);
+        else if (flag == "--reps")
+            options.reps = std::max(1, std::atoi(argv[++i]));
+        else if (flag == "--filter")
+            options.filter = argv[++i];
+        else
+        {
+            std::cerr << "Unknown option: " << flag << std::endl;
+            return 1;
+        }
+    }
+
+    BenchmarkRunner runner(options);
+    benchmark_quicksort(runner, options);
+    benchmark_huffman(runner, options);
+
+    // graph generation dominates start-up, so skip it when the filter excludes every graph workload
+    bool wants_graphs = false;
+    for (const char* algorithm : {"dijkstra", "prim_binary_heap", "prim_pairing_heap"})
+    {
+        for (const char* workload : {"random", "grid", "power_law"})
+            wants_graphs |= runner.selected(std::string(algorithm) + "/" + workload);
+    }
+
+    if (wants_graphs)
+    {
+        auto graphs = benchmark_graphs(options);
+        benchmark_dijkstra(runner, options, graphs);
+        benchmark_prim(runner, graphs);
+    }
+
+    runner.print();
+    return 0;
+}
@@ -0,0 +1,337 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Parallel loader for the "n_vertices n_edges" + "from to weight" text edge lists shared by the
+// Dijkstra and Prim tools. The input is mmapped (or slurped when it is a pipe), split at newline
+// boundaries across threads, parsed with std::from_chars into per-thread buffers, and turned into
+// a CSR adjacency (offsets + packed edges) using a prefix sum over vertex degrees.
+//
+// The format is strictly line based: the first line holds exactly the two header integers and
+// every following line holds exactly one edge, three integers separated by spaces or tabs.
+// Blank lines are skipped; any other line is an error. Because no record spans a line break,
+// the same file is accepted or rejected identically for every thread count.
+
+#ifndef EDGE_LIST_LOADER_H
+#define EDGE_LIST_LOADER_H
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace graph_io
+{
+
+// One edge as it appears in the input file
+struct EdgeRecord
+{
+    int from;
+    int to;
+    int weight;
+};
+
+struct EdgeList
+{
+    int n_vertices = 0;
+    std::vector<EdgeRecord> edges;
+};
+
+// Number of worker threads to use when the caller does not specify one
+inline int default_thread_count()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Run fn(begin, end, thread_id) over [0, count) split into contiguous chunks, one per thread
+template <typename Function>
+void parallel_for(int n_threads, size_t count, Function fn)
+{
+    if (n_threads <= 1 || count < 2)
+    {
+        fn(size_t(0), count, 0);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    size_t chunk = (count + n_threads - 1) / n_threads;
+    for (int t = 0; t < n_threads; ++t)
+    {
+        size_t begin = std::min(count, t * chunk);
+        size_t end = std::min(count, begin + chunk);
+        workers.emplace_back(fn, begin, end, t);
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+// Read-only view of an input file: mmapped when it is a regular file, copied otherwise
+class InputBuffer
+{
+    private:
+        void* mapping = MAP_FAILED;
+        size_t mapping_size = 0;
+        std::string storage;
+
+    public:
+        InputBuffer() = default;
+        InputBuffer(const InputBuffer&) = delete;
+        InputBuffer& operator=(const InputBuffer&) = delete;
+
+        ~InputBuffer()
+        {
+            if (mapping != MAP_FAILED)
+                munmap(mapping, mapping_size);
+        }
+
+        bool open_fd(int fd)
+        {
+            struct stat file_stat;
+            if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0)
+            {
+                mapping_size = file_stat.st_size;
+                mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping != MAP_FAILED)
+                {
+                    madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+                    return true;
+                }
+            }
+
+            // Pipes and terminals cannot be mapped, so fall back to reading everything
+            char block[1 << 16];
+            ssize_t n_read;
+            while ((n_read = read(fd, block, sizeof(block))) > 0)
+                storage.append(block, n_read);
+            return n_read == 0;
+        }
+
+        const char* begin() const
+        {
+            return mapping != MAP_FAILED ? static_cast<const char*>(mapping) : storage.data();
+        }
+
+        const char* end() const
+        {
+            return begin() + (mapping != MAP_FAILED ? mapping_size : storage.size());
+        }
+};
+
+// Separators allowed inside a line; '\r' is accepted so CRLF files parse
+inline bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool is_blank_line(const char* begin, const char* end)
+{
+    return std::all_of(begin, end, is_blank);
+}
+
+// True when both endpoints of edge lie in [0, n_vertices)
+inline bool edge_in_range(const EdgeRecord& edge, int n_vertices)
+{
+    return edge.from >= 0 && edge.from < n_vertices && edge.to >= 0 && edge.to < n_vertices;
+}
+
+// Message reported for an edge that fails edge_in_range
+inline std::string out_of_range_message(const EdgeRecord& edge, int n_vertices)
+{
+    return "edge " + std::to_string(edge.from) + " " + std::to_string(edge.to) + " out of range. Total vertex: " + std::to_string(n_vertices);
+}
+
+// Parse one integer field of a line, advancing cursor; false on malformed or missing input
+template <typename Integer>
+bool parse_field(const char*& cursor, const char* end, Integer& value)
+{
+    while (cursor < end && is_blank(*cursor))
+        ++cursor;
+
+    auto [next, error] = std::from_chars(cursor, end, value);
+    if (error != std::errc() || (next < end && !is_blank(*next)))
+        return false;
+
+    cursor = next;
+    return true;
+}
+
+// Parse the line [begin, end) (without its newline), which must hold exactly one integer per value
+template <typename... Integer>
+bool parse_line(const char* begin, const char* end, Integer&... values)
+{
+    return (parse_field(begin, end, values) && ...) && is_blank_line(begin, end);
+}
+
+// Parse the edge list in fd with n_threads workers. The graph must have at least one vertex and
+// every endpoint is checked against [0, n_vertices); on failure error describes the first problem found and false is returned.
+inline bool load_edge_list(int fd, int n_threads, EdgeList& graph, std::string& error)
+{
+    InputBuffer input;
+    if (!input.open_fd(fd))
+    {
+        error = "could not read input";
+        return false;
+    }
+
+    const char* end = input.end();
+    const char* cursor = std::find(input.begin(), end, '\n');
+    long long n_edges = 0;
+    if (!parse_line(input.begin(), cursor, graph.n_vertices, n_edges) || graph.n_vertices < 1 || n_edges < 0)
+    {
+        error = "malformed header, the first line must hold a vertex count of at least 1 and a non-negative edge count";
+        return false;
+    }
+
+    // Split the body into one slice per thread, moving each cut forward to the next newline
+    // so that no line is shared between two threads
+    std::vector<const char*> cuts(n_threads + 1, end);
+    cuts[0] = cursor;
+    for (int t = 1; t < n_threads; ++t)
+    {
+        const char* cut = std::max(cuts[t - 1], cursor + (end - cursor) / n_threads * t);
+        while (cut < end && *cut != '\n')
+            ++cut;
+        cuts[t] = cut;
+    }
+
+    std::vector<std::vector<EdgeRecord>> thread_edges(n_threads);
+    std::vector<std::string> thread_errors(n_threads);
+    const int n_vertices = graph.n_vertices;
+
+    parallel_for(n_threads, n_threads, [&](size_t first, size_t last, int)
+    {
+        for (size_t t = first; t < last; ++t)
+        {
+            const char* position = cuts[t];
+            const char* slice_end = cuts[t + 1];
+            std::vector<EdgeRecord>& edges = thread_edges[t];
+            edges.reserve((slice_end - position) / 8);
+
+            while (position < slice_end)
+            {
+                const char* line_end = std::find(position, slice_end, '\n');
+                if (!is_blank_line(position, line_end))
+                {
+                    EdgeRecord edge;
+                    if (!parse_line(position, line_end, edge.from, edge.to, edge.weight))
+                    {
+                        thread_errors[t] = "malformed edge line near byte " + std::to_string(position - input.begin());
+                        break;
+                    }
+                    if (!edge_in_range(edge, n_vertices))
+                    {
+                        thread_errors[t] = out_of_range_message(edge, n_vertices);
+                        break;
+                    }
+                    edges.push_back(edge);
+                }
+                position = std::min(line_end + 1, slice_end);
+            }
+        }
+    });
+
+    // Work out where each thread's buffer lands in the final array. Only the first n_edges records
+    // are used, so a thread's error counts only if it hit it before record n_edges; anything after
+    // that is ignored whatever the thread count
+    std::vector<size_t> offsets(n_threads + 1, 0);
+    for (int t = 0; t < n_threads; ++t)
+    {
+        if (!thread_errors[t].empty() && offsets[t] + thread_edges[t].size() < size_t(n_edges))
+        {
+            error = thread_errors[t];
+            return false;
+        }
+        offsets[t + 1] = offsets[t] + thread_edges[t].size();
+    }
+    if (offsets[n_threads] < size_t(n_edges))
+    {
+        error = "expected " + std::to_string(n_edges) + " edges, found " + std::to_string(offsets[n_threads]);
+        return false;
+    }
+
+    graph.edges.resize(n_edges);
+    parallel_for(n_threads, n_threads, [&](size_t first, size_t last, int)
+    {
+        for (size_t t = first; t < last; ++t)
+        {
+            size_t count = std::min(thread_edges[t].size(), size_t(n_edges) - std::min(size_t(n_edges), offsets[t]));
+            std::copy_n(thread_edges[t].begin(), count, graph.edges.begin() + offsets[t]);
+            std::vector<EdgeRecord>().swap(thread_edges[t]);
+        }
+    });
+    return true;
+}
+
+// Build a CSR adjacency from an edge list: count degrees, prefix-sum them into offsets
+// (size n_vertices + 1), then scatter every edge into its slot. AdjacencyEdge must be
+// constructible from (to, weight). Undirected graphs store each edge in both directions.
+template <typename AdjacencyEdge>
+void build_csr(int n_vertices, const std::vector<EdgeRecord>& edges, bool undirected, int n_threads, std::vector<size_t>& offsets, std::vector<AdjacencyEdge>& adjacency)
+{
+    std::vector<std::atomic<size_t>> cursor(n_vertices);
+    parallel_for(n_threads, n_vertices, [&](size_t begin, size_t end, int)
+    {
+        for (size_t v = begin; v < end; ++v)
+            cursor[v].store(0, std::memory_order_relaxed);
+    });
+
+    parallel_for(n_threads, edges.size(), [&](size_t begin, size_t end, int)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            cursor[edges[i].from].fetch_add(1, std::memory_order_relaxed);
+            if (undirected)
+                cursor[edges[i].to].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    // Blocked exclusive prefix sum: per-thread block totals, a short serial scan over the
+    // blocks, then each thread writes its own block's offsets
+    offsets.assign(n_vertices + 1, 0);
+    std::vector<size_t> block_totals(n_threads + 1, 0);
+    parallel_for(n_threads, n_vertices, [&](size_t begin, size_t end, int thread_id)
+    {
+        size_t sum = 0;
+        for (size_t v = begin; v < end; ++v)
+            sum += cursor[v].load(std::memory_order_relaxed);
+        block_totals[thread_id + 1] = sum;
+    });
+    for (int t = 0; t < n_threads; ++t)
+        block_totals[t + 1] += block_totals[t];
+
+    parallel_for(n_threads, n_vertices, [&](size_t begin, size_t end, int thread_id)
+    {
+        size_t running = block_totals[thread_id];
+        for (size_t v = begin; v < end; ++v)
+        {
+            size_t degree = cursor[v].load(std::memory_order_relaxed);
+            offsets[v] = running;
+            cursor[v].store(running, std::memory_order_relaxed);
+            running += degree;
+        }
+    });
+    offsets[n_vertices] = block_totals[n_threads];
+
+    adjacency.assign(offsets[n_vertices], AdjacencyEdge(0, 0));
+    parallel_for(n_threads, edges.size(), [&](size_t begin, size_t end, int)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const EdgeRecord& edge = edges[i];
+            adjacency[cursor[edge.from].fetch_add(1, std::memory_order_relaxed)] = AdjacencyEdge(edge.to, edge.weight);
+            if (undirected)
+                adjacency[cursor[edge.to].fetch_add(1, std::memory_order_relaxed)] = AdjacencyEdge(edge.from, edge.weight);
+        }
+    });
+}
+
+}
+
+#endif
@@ -0,0 +1,320 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Optional hot-path instrumentation shared by all four tools. Everything here is switched on
+// at compile time and expands to nothing otherwise:
+//
+//   -DALGO_COUNTERS      ALGO_COUNT(name) bumps a per-thread event counter (comparisons, swaps,
+//                        heap sift steps, relaxations, ...)
+//   -DALGO_PERF_EVENTS   ALGO_PHASE("name") starts a program phase; each phase records wall time
+//                        and, where the kernel allows perf_event_open, cycles, cache misses and
+//                        branch misses
+//
+// ALGO_REPORT_ON_EXIT() at the top of main prints whatever was collected to stderr when main returns.
+// Both include work done on worker threads, as long as those threads have been joined by then.
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#if defined(ALGO_COUNTERS) || defined(ALGO_PERF_EVENTS)
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef ALGO_PERF_EVENTS
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace instrumentation
+{
+
+// Event counts for the hot loops; each tool only touches the fields that apply to it
+struct HotPathCounters
+{
+    uint64_t partition_comparisons = 0;
+    uint64_t partition_swaps = 0;
+    uint64_t heap_pushes = 0;
+    uint64_t heap_pops = 0;
+    uint64_t heap_sift_up_steps = 0;
+    uint64_t heap_sift_down_steps = 0;
+    uint64_t heap_decrease_keys = 0;
+    uint64_t heap_link_steps = 0;
+    uint64_t edge_relaxations = 0;
+    uint64_t settled_vertices = 0;
+
+    void add(const HotPathCounters& other)
+    {
+        partition_comparisons += other.partition_comparisons;
+        partition_swaps += other.partition_swaps;
+        heap_pushes += other.heap_pushes;
+        heap_pops += other.heap_pops;
+        heap_sift_up_steps += other.heap_sift_up_steps;
+        heap_sift_down_steps += other.heap_sift_down_steps;
+        heap_decrease_keys += other.heap_decrease_keys;
+        heap_link_steps += other.heap_link_steps;
+        edge_relaxations += other.edge_relaxations;
+        settled_vertices += other.settled_vertices;
+    }
+};
+
+// Counts folded in from threads that have already exited
+struct ExitedThreadCounters
+{
+    std::mutex lock;
+    HotPathCounters totals;
+};
+
+inline ExitedThreadCounters& exited_threads()
+{
+    static ExitedThreadCounters instance;
+    return instance;
+}
+
+// Each thread counts into its own copy without synchronisation and adds it to the shared
+// totals once, when the thread exits
+struct ThreadCounters
+{
+    HotPathCounters values;
+
+    ~ThreadCounters()
+    {
+        ExitedThreadCounters& exited = exited_threads();
+        std::lock_guard<std::mutex> guard(exited.lock);
+        exited.totals.add(values);
+    }
+};
+
+inline HotPathCounters& counters()
+{
+    static thread_local ThreadCounters instance;
+    return instance.values;
+}
+
+// Counts from exited threads plus the calling thread's own
+inline HotPathCounters total_counters()
+{
+    HotPathCounters totals = counters();
+    ExitedThreadCounters& exited = exited_threads();
+    std::lock_guard<std::mutex> guard(exited.lock);
+    totals.add(exited.totals);
+    return totals;
+}
+
+#ifdef ALGO_PERF_EVENTS
+
+// Hardware counters for cycles, cache misses and branch misses. Each event is opened with
+// inherit set, so threads started afterwards (the parallel loader, Boruvka, landmark
+// preprocessing) are counted too; their counts reach the totals when they exit. Inherited
+// events cannot be read as a group, so each is opened and read on its own.
+class PerfEventCounters
+{
+    private:
+        static constexpr int N_EVENTS = 3;
+        int fds[N_EVENTS] = {-1, -1, -1};
+
+        static int open_event(uint64_t config)
+        {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        }
+
+    public:
+        PerfEventCounters()
+        {
+            const uint64_t configs[N_EVENTS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+            for (int i = 0; i < N_EVENTS; ++i)
+            {
+                fds[i] = open_event(configs[i]);
+                if (fds[i] < 0)
+                {
+                    close_all();
+                    return;
+                }
+            }
+            for (int fd : fds)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+
+        ~PerfEventCounters()
+        {
+            close_all();
+        }
+
+        void close_all()
+        {
+            for (int& fd : fds)
+            {
+                if (fd >= 0)
+                    close(fd);
+                fd = -1;
+            }
+        }
+
+        bool available() const
+        {
+            return fds[0] >= 0;
+        }
+
+        // Current totals for cycles, cache misses and branch misses
+        bool read_values(uint64_t values[N_EVENTS]) const
+        {
+            if (!available())
+                return false;
+            for (int i = 0; i < N_EVENTS; ++i)
+            {
+                if (read(fds[i], &values[i], sizeof(uint64_t)) != ssize_t(sizeof(uint64_t)))
+                    return false;
+            }
+            return true;
+        }
+};
+
+// Splits a run into consecutive named phases; starting a phase closes the previous one
+class PhaseProfiler
+{
+    private:
+        struct Phase
+        {
+            std::string name;
+            double wall_ms;
+            uint64_t events[3];
+            bool has_events;
+        };
+
+        PerfEventCounters perf_events;
+        std::vector<Phase> phases;
+        std::string current;
+        std::chrono::steady_clock::time_point started;
+        uint64_t start_events[3] = {};
+        bool running = false;
+
+    public:
+        void begin_phase(const char* name)
+        {
+            end_phase();
+            current = name;
+            running = true;
+            perf_events.read_values(start_events);
+            started = std::chrono::steady_clock::now();
+        }
+
+        void end_phase()
+        {
+            if (!running)
+                return;
+
+            auto now = std::chrono::steady_clock::now();
+            Phase phase{current, std::chrono::duration<double, std::milli>(now - started).count(), {}, false};
+            uint64_t end_events[3];
+            if (perf_events.read_values(end_events))
+            {
+                phase.has_events = true;
+                for (int i = 0; i < 3; ++i)
+                    phase.events[i] = end_events[i] - start_events[i];
+            }
+            phases.push_back(phase);
+            running = false;
+        }
+
+        void report(std::ostream& out)
+        {
+            end_phase();
+            if (!perf_events.available())
+                out << "[phase] perf_event_open unavailable, reporting wall time only" << std::endl;
+            else
+                out << "[phase] hardware events include joined worker threads" << std::endl;
+
+            for (const Phase& phase : phases)
+            {
+                out << "[phase] " << phase.name << " wall_ms " << phase.wall_ms;
+                if (phase.has_events)
+                    out << " cycles " << phase.events[0] << " cache_misses " << phase.events[1] << " branch_misses " << phase.events[2];
+                out << std::endl;
+            }
+        }
+};
+
+inline PhaseProfiler& profiler()
+{
+    static PhaseProfiler instance;
+    return instance;
+}
+
+#endif
+
+// Prints the collected counters and phases when main's scope ends
+struct ReportOnExit
+{
+    ~ReportOnExit()
+    {
+#ifdef ALGO_PERF_EVENTS
+        profiler().report(std::cerr);
+#endif
+#ifdef ALGO_COUNTERS
+        const HotPathCounters c = total_counters();
+        const std::pair<const char*, uint64_t> entries[] = {
+            {"partition_comparisons", c.partition_comparisons},
+            {"partition_swaps", c.partition_swaps},
+            {"heap_pushes", c.heap_pushes},
+            {"heap_pops", c.heap_pops},
+            {"heap_sift_up_steps", c.heap_sift_up_steps},
+            {"heap_sift_down_steps", c.heap_sift_down_steps},
+            {"heap_decrease_keys", c.heap_decrease_keys},
+            {"heap_link_steps", c.heap_link_steps},
+            {"edge_relaxations", c.edge_relaxations},
+            {"settled_vertices", c.settled_vertices},
+        };
+        for (const auto& [name, value] : entries)
+        {
+            if (value != 0)
+                std::cerr << "[counter] " << name << " " << value << std::endl;
+        }
+#endif
+    }
+};
+
+}
+
+#endif
+
+#ifdef ALGO_COUNTERS
+#define ALGO_COUNT(name) (++instrumentation::counters().name)
+#else
+#define ALGO_COUNT(name) ((void)0)
+#endif
+
+#ifdef ALGO_PERF_EVENTS
+#define ALGO_PHASE(name) instrumentation::profiler().begin_phase(name)
+#else
+#define ALGO_PHASE(name) ((void)0)
+#endif
+
+#if defined(ALGO_COUNTERS) || defined(ALGO_PERF_EVENTS)
+#define ALGO_REPORT_ON_EXIT() instrumentation::ReportOnExit algo_report_on_exit
+#else
+#define ALGO_REPORT_ON_EXIT() ((void)0)
+#endif
+
+#endif
@@ -5,238 +5,186 @@
 
 #include <iostream>
 #include <vector>
-#include <limits>
 #include <algorithm>
+#include <string>
+#include <fstream>
+#include <cstring>
 
-// Define infinity (i.e max int range in c++) for distance comparisons
-const int INF = std::numeric_limits<int>::max();
+#include "dijkstras_algo.h"
+#include "../common/edge_list_loader.h"
+#include "../common/instrumentation.h"
 
-//Edge Structure representing a weighted connection between vertices
-struct Edge
+using namespace dijkstra;
+
+// Landmark table owned by the CLI together with its on-disk form:
+// "ALT1", n_vertices, k, the k landmark ids and the LandmarkView rows, all int32
+struct LandmarkFile
 {
-    int to;
-    int weight;
+    int n_vertices = 0;
+    std::vector<int> landmarks;
+    std::vector<int> table;
 
-    Edge(int edge_to, int edge_weight) : to(edge_to), weight(edge_weight)
+    LandmarkView view() const
     {
-
+        return LandmarkView{n_vertices, landmarks, table};
     }
-};
-
-// Node structure for the priority queue
-struct Node
-{
-    int vertex;
-    int distance;
 
-
-    Node(int vertex_label, int vertex_distance) : vertex(vertex_label), distance(vertex_distance)
+    bool save(const char* path) const
     {
-
+        std::ofstream output(path, std::ios::binary);
+        int k = landmarks.size();
+        output.write("ALT1", 4);
+        output.write(reinterpret_cast<const char*>(&n_vertices), sizeof(int));
+        output.write(reinterpret_cast<const char*>(&k), sizeof(int));
+        output.write(reinterpret_cast<const char*>(landmarks.data()), sizeof(int) * k);
+        output.write(reinterpret_cast<const char*>(table.data()), sizeof(int) * table.size());
+        return bool(output);
     }
-};
-
-// Custom min-heap for O(log n) vertex extraction and distance updates
-class Heap
-{
-    private:
-        std::vector<Node> heap;
-        std::vector<int> position;
-
-        // Restores the min-heap property by moving a node up the heap
-        // Used when a node's priority decreases (distance becomes smaller)
-        void heapify_Up(int i)
-        {
-            while(i > 0)
-            {
-                int parent = (i - 1) / 2;
-                if(heap[i].distance >= heap[parent].distance)
-                    break;
-                std::swap(heap[i], heap[parent]);
-                position[heap[i].vertex] = i;
-                position[heap[parent].vertex] = parent;
-                
-                i = parent;
-            }
-        }
-
-        // Restores the min-heap property by moving a node down the heap
-        // Used after extracting the minimum element or when a node's priority increases
-        void heapify_Down(int i)
-        {
-            int heap_size = heap.size();
-
-
-            while(true)
-            {
-                int smallest_ele = i;
-                int left_vertex = 2 * i + 1;
-                int right_vertex = 2 * i + 2;
-                if(left_vertex < heap_size && heap[left_vertex].distance < heap[smallest_ele].distance)
-                    smallest_ele = left_vertex;
-                
-                if(right_vertex < heap_size && heap[right_vertex].distance < heap[smallest_ele].distance)
-                    smallest_ele = right_vertex;
-
-                if(smallest_ele == i)
-                    break;
 
-                std::swap(heap[i], heap[smallest_ele]);
-                position[heap[i].vertex] = i;
-                position[heap[smallest_ele].vertex] = smallest_ele;
-
-                i = smallest_ele;
-            }
-        }
-
-    public:
-        Heap(int size) : position(size, - 1)
-        {
-
-        }
-
-        // core heap operations push, pop, heap decrease key
-        void push(const Node& node)
-        {
-            heap.push_back(node);
-            position[node.vertex] = heap.size() - 1;
-            heapify_Up(heap.size() - 1);
-        }
-
-        Node pop()
-        {
-            Node root = heap[0];
-            heap[0] = heap.back();
-            heap.pop_back();
-            if(!heap.empty())
-            {
-                position[heap[0].vertex] = 0;
-                heapify_Down(0);
-            }
-
-            position[root.vertex] = -1;
-            return root;
-        }
-
-        // Updates the distance of a vertex when a shorter path is found and restores the heap property
-        void heap_Decrease_Key(int vertex, int newDistance)
-        {
-            int i = position[vertex];
-            if (i == -1) 
-            {
-                push(Node(vertex, newDistance));
-            } 
-            else if (newDistance < heap[i].distance) 
-            {
-                heap[i].distance = newDistance;
-                heapify_Up(i);
-            }
-        }
-
-        bool empty() const
+    // Load a table built for a graph with expected_vertices vertices. Landmark ids are used as
+    // search sources and table rows, so a stale or corrupt file with any id outside the graph is rejected.
+    bool load(const char* path, int expected_vertices)
+    {
+        std::ifstream input(path, std::ios::binary);
+        char magic[4];
+        int k = 0;
+        input.read(magic, 4);
+        input.read(reinterpret_cast<char*>(&n_vertices), sizeof(int));
+        input.read(reinterpret_cast<char*>(&k), sizeof(int));
+        if(!input || std::memcmp(magic, "ALT1", 4) != 0 || n_vertices != expected_vertices || k < 1 || k > n_vertices)
+            return false;
+
+        landmarks.resize(k);
+        input.read(reinterpret_cast<char*>(landmarks.data()), sizeof(int) * k);
+        for(int landmark : landmarks)
         {
-            return heap.empty();
+            if(landmark < 0 || landmark >= n_vertices)
+                return false;
         }
 
+        table.resize(size_t(n_vertices) * 2 * k);
+        input.read(reinterpret_cast<char*>(table.data()), sizeof(int) * table.size());
+        return bool(input);
+    }
 };
 
-
-// constructing graph network with nodes and vertices
-class Graph
+void print_Usage(const char* program)
 {
-    private:
-        int vertices;
-        std::vector<std::vector<Edge>> adjacency_List;
-
-    public:
-        Graph(int v) : vertices(v), adjacency_List(v)
-        {
-
-        }
-
-        // add directed edge between the vertex in graph
-        void addEdge(int from, int to, int weight)
-        {
-            adjacency_List[from].emplace_back(to, weight);
-        }
-
-        // Finds the shortest path from start to end using Dijkstra's algorithm
-        // Returns the shortest distance or -1 if no path exists
-        int dijkstra_Algorithm(int start, int end)
-        {
-            std::vector<int> dist(vertices, INF);
-            dist[start] = 0;
-
-            Heap priority_queue(vertices);
-            priority_queue.push(Node(start, 0));
-
-            while(!priority_queue.empty())
-            {
-                Node current_vertex = priority_queue.pop();
-                int vertex_label = current_vertex.vertex;
-                int vertex_distance = current_vertex.distance;
-
-                if(vertex_label == end)
-                    return vertex_distance;
-                
-                if(vertex_distance > dist[vertex_label])
-                    continue;
-
-                for(const Edge& edge : adjacency_List[vertex_label])
-                {
-                    int edge_to = edge.to;
-                    int edge_weight = edge.weight;
-
-                    if(dist[vertex_label] + edge_weight < dist[edge_to])
-                    {
-                        dist[edge_to] = dist[vertex_label] + edge_weight;
-                        priority_queue.heap_Decrease_Key(edge_to, dist[edge_to]);
-                    }
-                }
-            }
-
-            return -1;
-        }
-};
+    std::cerr << "Usage: " << program << " [start vertex] [end_vertex] < [graph_file_name.txt]" << std::endl;
+    std::cerr << "       " << program << " --alt-preprocess [landmarks] [landmark_file.bin] < [graph_file_name.txt]" << std::endl;
+    std::cerr << "       " << program << " --alt-refresh [landmark_file.bin] < [graph_file_name.txt]" << std::endl;
+    std::cerr << "       " << program << " --alt [landmark_file.bin] [start vertex] [end_vertex] < [graph_file_name.txt]" << std::endl;
+    std::cerr << "       " << program << " --alt-compare [landmark_file.bin] [start vertex] [end_vertex] < [graph_file_name.txt]" << std::endl;
+}
 
 int main(int argc, char *argv[])
 {
+    ALGO_REPORT_ON_EXIT();
+    std::string mode = argc > 1 ? argv[1] : "";
+    bool preprocess = (mode == "--alt-preprocess" && argc == 4);
+    bool refresh = (mode == "--alt-refresh" && argc == 3);
+    bool alt_compare = (mode == "--alt-compare" && argc == 5);
+    bool alt_query = ((mode == "--alt" || alt_compare) && argc == 5);
 
     // check for number of arguments passed through command line
-    if(argc != 3)
+    if(argc != 3 && !preprocess && !refresh && !alt_query)
     {
-        std::cerr << "Usage: " << argv[0] << " [start vertex] [end_vertex] < [graph_file_name.txt]" << std::endl;
+        print_Usage(argv[0]);
         return 1;
     }
 
-    int start_vertex = std::atoi(argv[1]);
-    int end_vertex = std::atoi(argv[2]);
+    int start_vertex = alt_query ? std::atoi(argv[3]) : std::atoi(argv[1]);
+    int end_vertex = alt_query ? std::atoi(argv[4]) : std::atoi(argv[2]);
+    ALGO_PHASE("parse");
 
-    // Read number of vertex and number of edges from file using standard input
-    int n_vertex, n_edges;
-    std::cin >> n_vertex >> n_edges;
+    // Read and validate the graph from standard input, parsing it in parallel
+    int n_threads = graph_io::default_thread_count();
+    graph_io::EdgeList edge_list;
+    std::string error;
+    if(!graph_io::load_edge_list(0, n_threads, edge_list, error))
+    {
+        std::cerr << "Invalid graph input: " << error << std::endl;
+        return 1;
+    }
+    int n_vertex = edge_list.n_vertices;
 
     // validate start vertex and end vertex are within range
-    if(start_vertex < 0 || start_vertex > n_vertex || end_vertex < 0 || end_vertex > n_vertex)
+    if(!preprocess && !refresh && (start_vertex < 0 || start_vertex >= n_vertex || end_vertex < 0 || end_vertex >= n_vertex))
     {
         std::cerr << "Start index or end index out of range. Total vertex: " << n_vertex << std::endl;
         return 1;
     }
 
-    Graph graph(n_vertex);
-
     // Construct graph from input
-    for(int i = 0; i < n_edges; ++i)
+    ALGO_PHASE("build");
+    Graph graph(n_vertex, edge_list.edges, n_threads);
+    ALGO_PHASE("solve");
+
+    if(preprocess || refresh)
     {
-        int vertex1, vertex2, weight;
-        std::cin >> vertex1 >> vertex2 >> weight;
-        graph.addEdge(vertex1, vertex2, weight);
+        // landmark distances to each vertex need the reversed graph
+        for(graph_io::EdgeRecord& edge : edge_list.edges)
+            std::swap(edge.from, edge.to);
+        Graph reverse_graph(n_vertex, edge_list.edges, n_threads);
+
+        LandmarkFile landmarks;
+        const char* path = preprocess ? argv[3] : argv[2];
+        if(refresh && !landmarks.load(path, n_vertex))
+        {
+            std::cerr << "Could not read landmark file for a graph with " << n_vertex << " vertices: " << path << std::endl;
+            return 1;
+        }
+
+        // a refresh keeps the stored landmarks and only recomputes their distances
+        if(preprocess)
+        {
+            landmarks.n_vertices = n_vertex;
+            landmarks.landmarks.resize(std::max(1, std::atoi(argv[2])));
+            landmarks.landmarks.resize(choose_Farthest_Landmarks(graph.view(), landmarks.landmarks));
+        }
+        landmarks.table.resize(size_t(n_vertex) * 2 * landmarks.landmarks.size());
+        compute_Landmark_Table(graph.view(), reverse_graph.view(), landmarks.landmarks, landmarks.table, n_threads);
+
+        ALGO_PHASE("output");
+        if(!landmarks.save(path))
+        {
+            std::cerr << "Could not write landmark file: " << path << std::endl;
+            return 1;
+        }
+        std::cout << landmarks.landmarks.size() << " landmarks written to " << path << std::endl;
+        return 0;
     }
 
+    int result;
+    if(alt_query)
+    {
+        LandmarkFile landmarks;
+        if(!landmarks.load(argv[2], n_vertex))
+        {
+            std::cerr << "Could not read landmark file for a graph with " << n_vertex << " vertices: " << argv[2] << std::endl;
+            return 1;
+        }
 
-    // calling dijkstra's algorithm function and finding shortest path between start and end vertex
-    int result = graph.dijkstra_Algorithm(start_vertex, end_vertex);
+        // answer with ALT and report how much of the graph it settled; only --alt-compare pays for
+        // a second, plain Dijkstra search to show the saving
+        long long alt_settled = 0;
+        result = alt_Algorithm(graph.view(), landmarks.view(), start_vertex, end_vertex, std::pmr::get_default_resource(), &alt_settled);
+        std::cerr << "settled vertices: alt " << alt_settled;
+        if(alt_compare)
+        {
+            long long dijkstra_settled = 0;
+            dijkstra_Algorithm(graph.view(), start_vertex, end_vertex, std::pmr::get_default_resource(), &dijkstra_settled);
+            std::cerr << " dijkstra " << dijkstra_settled;
+        }
+        std::cerr << std::endl;
+    }
+    else
+    {
+        // calling dijkstra's algorithm function and finding shortest path between start and end vertex
+        result = dijkstra_Algorithm(graph.view(), start_vertex, end_vertex);
+    }
 
+    ALGO_PHASE("output");
     if(result == -1)
     {
         std::cout << "not connected" << std::endl;
@@ -247,4 +195,4 @@ int main(int argc, char *argv[])
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,120 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Dijkstra and ALT (A*, landmarks, triangle inequality) shortest paths as a library. Graphs and
+// landmark tables are read through std::span views over caller-owned CSR buffers, and every
+// temporary (distances, heap, potentials) is taken from a caller-supplied std::pmr::memory_resource,
+// so a monotonic_buffer_resource over a reused buffer makes a query allocation-free. Nothing here prints.
+
+#ifndef DIJKSTRAS_ALGO_H
+#define DIJKSTRAS_ALGO_H
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "../common/edge_list_loader.h"
+
+namespace dijkstra
+{
+
+// Define infinity (i.e max int range in c++) for distance comparisons
+const int INF = std::numeric_limits<int>::max();
+
+//Edge Structure representing a weighted connection between vertices
+struct Edge
+{
+    int to;
+    int weight;
+
+    Edge(int edge_to, int edge_weight) : to(edge_to), weight(edge_weight)
+    {
+
+    }
+};
+
+// Non-owning directed graph in CSR form: the outgoing edges of vertex v are
+// edges[offsets[v] .. offsets[v + 1]), so offsets holds n_vertices + 1 entries
+struct GraphView
+{
+    int n_vertices = 0;
+    std::span<const size_t> offsets;
+    std::span<const Edge> edges;
+
+    std::span<const Edge> neighbours(int vertex) const
+    {
+        return edges.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+    }
+};
+
+// constructing graph network with nodes and vertices, owning the CSR buffers a GraphView points at
+class Graph
+{
+    private:
+        int vertices;
+        std::vector<size_t> offsets;
+        std::vector<Edge> edges;
+
+    public:
+        // build the directed adjacency from an edge list using n_threads workers
+        Graph(int v, const std::vector<graph_io::EdgeRecord>& edge_list, int n_threads = 1) : vertices(v)
+        {
+            graph_io::build_csr(vertices, edge_list, false, n_threads, offsets, edges);
+        }
+
+        GraphView view() const
+        {
+            return GraphView{vertices, offsets, edges};
+        }
+
+        int size() const
+        {
+            return vertices;
+        }
+};
+
+// Non-owning landmark table. For every vertex v, table holds d(L, v) for each landmark L followed by
+// d(v, L), i.e. row v is table[v * 2k .. (v + 1) * 2k) with k = landmarks.size(); INF marks no path.
+struct LandmarkView
+{
+    int n_vertices = 0;
+    std::span<const int> landmarks;
+    std::span<const int> table;
+
+    // Lower bound on d(vertex, target) from the triangle inequality over all landmarks,
+    // or INF when the landmarks prove target is unreachable from vertex
+    int lower_Bound(int vertex, int target) const;
+};
+
+// Upper bound on the scratch bytes one dijkstra_Algorithm, alt_Algorithm or shortest_Distances
+// call needs on a graph with n_vertices vertices
+size_t dijkstra_scratch_bytes(int n_vertices);
+
+// Finds the shortest path from start to end using Dijkstra's algorithm
+// Returns the shortest distance or -1 if no path exists; settled counts settled vertices when given
+int dijkstra_Algorithm(GraphView graph, int start, int end, std::pmr::memory_resource* scratch = std::pmr::get_default_resource(), long long* settled = nullptr);
+
+// Distances from source to every vertex written into dist (size n_vertices, INF when unreachable)
+void shortest_Distances(GraphView graph, int source, std::span<int> dist, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+// A* search guided by the landmark lower bounds; same contract as dijkstra_Algorithm
+int alt_Algorithm(GraphView graph, LandmarkView landmarks, int start, int end, std::pmr::memory_resource* scratch = std::pmr::get_default_resource(), long long* settled = nullptr);
+
+// Farthest-landmark selection: starting from vertex 0, repeatedly add the vertex farthest from all
+// landmarks chosen so far, where vertices none of them can reach count as farthest of all. Fills
+// landmarks and returns how many were chosen (fewer than landmarks.size() only when every vertex
+// is already a landmark, or 0 for an empty graph).
+int choose_Farthest_Landmarks(GraphView forward, std::span<int> landmarks, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+// Fill table (n_vertices * 2 * landmarks.size() entries, layout as in LandmarkView) with forward
+// distances from forward and backward distances from the reversed graph. The 2k searches are
+// independent and spread across n_threads, each with its own slice of scratch.
+void compute_Landmark_Table(GraphView forward, GraphView backward, std::span<const int> landmarks, std::span<int> table, int n_threads, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+}
+
+#endif
@@ -0,0 +1,315 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+#include <algorithm>
+
+#include "dijkstras_algo.h"
+#include "../common/instrumentation.h"
+
+namespace dijkstra
+{
+
+// Node structure for the priority queue
+struct Node
+{
+    int vertex;
+    int distance;
+
+
+    Node(int vertex_label, int vertex_distance) : vertex(vertex_label), distance(vertex_distance)
+    {
+
+    }
+};
+
+// Custom min-heap for O(log n) vertex extraction and distance updates
+class Heap
+{
+    private:
+        std::pmr::vector<Node> heap;
+        std::pmr::vector<int> position;
+
+        // Restores the min-heap property by moving a node up the heap
+        // Used when a node's priority decreases (distance becomes smaller)
+        void heapify_Up(int i)
+        {
+            while(i > 0)
+            {
+                ALGO_COUNT(heap_sift_up_steps);
+                int parent = (i - 1) / 2;
+                if(heap[i].distance >= heap[parent].distance)
+                    break;
+                std::swap(heap[i], heap[parent]);
+                position[heap[i].vertex] = i;
+                position[heap[parent].vertex] = parent;
+                
+                i = parent;
+            }
+        }
+
+        // Restores the min-heap property by moving a node down the heap
+        // Used after extracting the minimum element or when a node's priority increases
+        void heapify_Down(int i)
+        {
+            int heap_size = heap.size();
+
+
+            while(true)
+            {
+                ALGO_COUNT(heap_sift_down_steps);
+                int smallest_ele = i;
+                int left_vertex = 2 * i + 1;
+                int right_vertex = 2 * i + 2;
+                if(left_vertex < heap_size && heap[left_vertex].distance < heap[smallest_ele].distance)
+                    smallest_ele = left_vertex;
+                
+                if(right_vertex < heap_size && heap[right_vertex].distance < heap[smallest_ele].distance)
+                    smallest_ele = right_vertex;
+
+                if(smallest_ele == i)
+                    break;
+
+                std::swap(heap[i], heap[smallest_ele]);
+                position[heap[i].vertex] = i;
+                position[heap[smallest_ele].vertex] = smallest_ele;
+
+                i = smallest_ele;
+            }
+        }
+
+    public:
+        // All storage, sized for every vertex at once, comes from scratch
+        Heap(int size, std::pmr::memory_resource* scratch) : heap(scratch), position(size, - 1, scratch)
+        {
+            heap.reserve(size);
+        }
+
+        // core heap operations push, pop, heap decrease key
+        void push(const Node& node)
+        {
+            ALGO_COUNT(heap_pushes);
+            heap.push_back(node);
+            position[node.vertex] = heap.size() - 1;
+            heapify_Up(heap.size() - 1);
+        }
+
+        Node pop()
+        {
+            ALGO_COUNT(heap_pops);
+            Node root = heap[0];
+            heap[0] = heap.back();
+            heap.pop_back();
+            if(!heap.empty())
+            {
+                position[heap[0].vertex] = 0;
+                heapify_Down(0);
+            }
+
+            position[root.vertex] = -1;
+            return root;
+        }
+
+        // Updates the distance of a vertex when a shorter path is found and restores the heap property
+        void heap_Decrease_Key(int vertex, int newDistance)
+        {
+            int i = position[vertex];
+            if (i == -1) 
+            {
+                push(Node(vertex, newDistance));
+            } 
+            else if (newDistance < heap[i].distance) 
+            {
+                ALGO_COUNT(heap_decrease_keys);
+                heap[i].distance = newDistance;
+                heapify_Up(i);
+            }
+        }
+
+        bool empty() const
+        {
+            return heap.empty();
+        }
+
+};
+
+// Shared search loop for plain Dijkstra and A*: vertices are keyed by dist + potential(v),
+// where potential is a consistent lower bound on the remaining distance to end and INF marks
+// a vertex that cannot reach end at all. With end == -1 the whole graph is explored.
+// Fills dist, counts settled vertices when asked, and returns dist[end] or -1.
+template <typename Potential>
+int goal_Directed_Search(GraphView graph, int start, int end, Potential potential, std::span<int> dist, std::pmr::memory_resource* scratch, long long* settled = nullptr)
+{
+    std::fill(dist.begin(), dist.end(), INF);
+    dist[start] = 0;
+
+    int start_potential = potential(start);
+    if(start_potential == INF)
+        return -1;
+
+    Heap priority_queue(graph.n_vertices, scratch);
+    priority_queue.push(Node(start, start_potential));
+
+    while(!priority_queue.empty())
+    {
+        Node current_vertex = priority_queue.pop();
+        int vertex_label = current_vertex.vertex;
+
+        if(current_vertex.distance > dist[vertex_label] + potential(vertex_label))
+            continue;
+
+        ALGO_COUNT(settled_vertices);
+        if(settled)
+            ++*settled;
+
+        if(vertex_label == end)
+            return dist[vertex_label];
+
+        for(const Edge& edge : graph.neighbours(vertex_label))
+        {
+            int edge_to = edge.to;
+            int edge_weight = edge.weight;
+
+            if(dist[vertex_label] + edge_weight < dist[edge_to])
+            {
+                int edge_to_potential = potential(edge_to);
+                if(edge_to_potential == INF)
+                    continue;
+
+                ALGO_COUNT(edge_relaxations);
+                dist[edge_to] = dist[vertex_label] + edge_weight;
+                priority_queue.heap_Decrease_Key(edge_to, dist[edge_to] + edge_to_potential);
+            }
+        }
+    }
+
+    return -1;
+}
+
+int LandmarkView::lower_Bound(int vertex, int target) const
+{
+    size_t k = landmarks.size();
+    const int* v_row = table.data() + vertex * 2 * k;
+    const int* t_row = table.data() + target * 2 * k;
+    int bound = 0;
+
+    for(size_t i = 0; i < k; ++i)
+    {
+        // d(L, v) + d(v, t) >= d(L, t)
+        if(t_row[i] != INF && v_row[i] != INF)
+            bound = std::max(bound, t_row[i] - v_row[i]);
+        else if(v_row[i] != INF)
+            return INF;
+
+        // d(v, t) + d(t, L) >= d(v, L)
+        if(v_row[k + i] != INF && t_row[k + i] != INF)
+            bound = std::max(bound, v_row[k + i] - t_row[k + i]);
+        else if(t_row[k + i] != INF)
+            return INF;
+    }
+    return bound;
+}
+
+size_t dijkstra_scratch_bytes(int n_vertices)
+{
+    // dist, potentials and heap positions (one int each per vertex) plus the heap's node array,
+    // with alignment slack for each of the four blocks
+    return size_t(n_vertices) * (3 * sizeof(int) + sizeof(Node)) + 4 * alignof(std::max_align_t);
+}
+
+int dijkstra_Algorithm(GraphView graph, int start, int end, std::pmr::memory_resource* scratch, long long* settled)
+{
+    std::pmr::vector<int> dist(graph.n_vertices, scratch);
+    return goal_Directed_Search(graph, start, end, [](int) { return 0; }, dist, scratch, settled);
+}
+
+void shortest_Distances(GraphView graph, int source, std::span<int> dist, std::pmr::memory_resource* scratch)
+{
+    goal_Directed_Search(graph, source, -1, [](int) { return 0; }, dist, scratch);
+}
+
+int alt_Algorithm(GraphView graph, LandmarkView landmarks, int start, int end, std::pmr::memory_resource* scratch, long long* settled)
+{
+    // potentials are computed lazily and cached, -1 meaning not computed yet
+    std::pmr::vector<int> potential(graph.n_vertices, -1, scratch);
+    auto lower_bound = [&](int vertex)
+    {
+        if(potential[vertex] == -1)
+            potential[vertex] = landmarks.lower_Bound(vertex, end);
+        return potential[vertex];
+    };
+
+    std::pmr::vector<int> dist(graph.n_vertices, scratch);
+    return goal_Directed_Search(graph, start, end, lower_bound, dist, scratch, settled);
+}
+
+int choose_Farthest_Landmarks(GraphView forward, std::span<int> landmarks, std::pmr::memory_resource* scratch)
+{
+    int vertices = forward.n_vertices;
+    if(vertices == 0)
+        return 0;       // no vertex 0 to start the farthest-first sweep from
+
+    std::pmr::vector<int> nearest_landmark(vertices, scratch);
+    std::pmr::vector<int> dist(vertices, scratch);
+    std::pmr::vector<bool> is_landmark(vertices, false, scratch);
+    shortest_Distances(forward, 0, nearest_landmark, scratch);
+
+    size_t chosen = 0;
+    while(chosen < landmarks.size())
+    {
+        int farthest = -1;
+        for(int v = 0; v < vertices; ++v)
+        {
+            // vertices no landmark reaches sit at INF and so rank as the farthest, which keeps the
+            // sweep going into parts of a directed graph the earlier landmarks cannot reach
+            if(!is_landmark[v] && (farthest == -1 || nearest_landmark[v] > nearest_landmark[farthest]))
+                farthest = v;
+        }
+        if(farthest == -1)
+            break;      // every vertex is already a landmark
+
+        landmarks[chosen] = farthest;
+        is_landmark[farthest] = true;
+        shortest_Distances(forward, farthest, dist, scratch);
+        for(int v = 0; v < vertices; ++v)
+            nearest_landmark[v] = (chosen == 0) ? dist[v] : std::min(nearest_landmark[v], dist[v]);
+        ++chosen;
+    }
+    return chosen;
+}
+
+void compute_Landmark_Table(GraphView forward, GraphView backward, std::span<const int> landmarks, std::span<int> table, int n_threads, std::pmr::memory_resource* scratch)
+{
+    int vertices = forward.n_vertices;
+    size_t k = landmarks.size();
+    size_t stride = 2 * k;
+
+    // Carve one block per thread out of scratch up front; memory resources are not thread-safe,
+    // so each worker then runs its searches on a private monotonic arena over its own block
+    size_t block_bytes = dijkstra_scratch_bytes(vertices);
+    std::pmr::vector<std::byte*> blocks(n_threads, scratch);
+    for(std::byte*& block : blocks)
+        block = static_cast<std::byte*>(scratch->allocate(block_bytes, alignof(std::max_align_t)));
+
+    graph_io::parallel_for(n_threads, stride, [&](size_t begin, size_t end, int thread_id)
+    {
+        std::pmr::monotonic_buffer_resource arena(blocks[thread_id], block_bytes, std::pmr::new_delete_resource());
+        for(size_t column = begin; column < end; ++column)
+        {
+            {
+                std::pmr::vector<int> dist(vertices, &arena);
+                GraphView graph = (column < k) ? forward : backward;
+                shortest_Distances(graph, landmarks[column % k], dist, &arena);
+                for(int v = 0; v < vertices; ++v)
+                    table[v * stride + column] = dist[v];
+            }
+            arena.release();
+        }
+    });
+
+    for(std::byte* block : blocks)
+        scratch->deallocate(block, block_bytes, alignof(std::max_align_t));
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Huffman code length computation as a library. Frequencies are read through a std::span over
+// caller-owned memory and every allocation (tree nodes and heap) is taken from a caller-supplied
+// std::pmr::memory_resource, so a monotonic_buffer_resource over a reused buffer makes a call
+// allocation-free. Nothing here prints.
+
+#ifndef HUFFMAN_H
+#define HUFFMAN_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace huffman
+{
+
+// Node structure for Huffman tree
+struct Node 
+{
+    int frequency;
+    char letter;
+    Node* left;
+    Node* right;
+    
+    // Constructor for creating a new node
+    Node(int freq, char letter = '\0', Node* l = nullptr, Node* r = nullptr) : frequency(freq), letter(letter), left(l), right(r)
+    {
+
+    }
+    
+    // Check if the node is a leaf (has no children)
+    bool isLeaf() const 
+    { 
+        return left == nullptr && right == nullptr; 
+    }
+};
+
+// Upper bound on the scratch bytes huffman_total_bits needs for n_symbols frequencies
+size_t huffman_scratch_bytes(size_t n_symbols);
+
+// Build the Huffman tree from frequency data. Nodes live in pool, which must outlive the tree;
+// it is reserved to its final size here so node pointers stay valid.
+Node* buildHuffmanTree(std::span<const int> frequencies, std::pmr::vector<Node>& pool);
+
+// Total number of bits needed to encode every symbol with the tree's code lengths
+long long calculateTotalBits(const Node* root, int depth = 0);
+
+// Tree construction plus bit count in one call, with all storage taken from scratch
+long long huffman_total_bits(std::span<const int> frequencies, std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+}
+
+#endif
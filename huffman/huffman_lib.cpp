@@ -0,0 +1,164 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+#include <algorithm>
+
+#include "huffman.h"
+#include "../common/instrumentation.h"
+
+namespace huffman
+{
+
+// Custom comparator for the min-heap
+struct CompareNode 
+{
+    bool operator()(const Node* l, const Node* r) const 
+    {
+        return l->frequency > r->frequency;
+    }
+};
+
+// Binary Heap (Priority Queue) implementation
+class BinaryHeap 
+{
+    private:
+        std::pmr::vector<Node*> heap;
+
+        // Maintain heap property by moving an element up
+        void heapifyUp(int index) 
+        {
+            while (index > 0) 
+            {
+                ALGO_COUNT(heap_sift_up_steps);
+                int parent = (index - 1) / 2;
+                if (heap[parent]->frequency <= heap[index]->frequency) break;
+                std::swap(heap[parent], heap[index]);
+                index = parent;
+            }
+        }
+
+        // Maintain heap property by moving an element down
+        void heapifyDown(int index) 
+        {
+            int size = heap.size();
+            while (true) 
+            {
+                ALGO_COUNT(heap_sift_down_steps);
+                int smallest = index;
+                int left = 2 * index + 1;
+                int right = 2 * index + 2;
+
+                if (left < size && heap[left]->frequency < heap[smallest]->frequency)
+                    smallest = left;
+                if (right < size && heap[right]->frequency < heap[smallest]->frequency)
+                    smallest = right;
+
+                if (smallest == index) break;
+
+                std::swap(heap[index], heap[smallest]);
+                index = smallest;
+            }
+        }
+
+    public:
+
+        // Reserve room for capacity nodes up front, taking the storage from scratch
+        BinaryHeap(size_t capacity, std::pmr::memory_resource* scratch) : heap(scratch) 
+        {
+            heap.reserve(capacity);
+        }
+
+        // Add a new node to the heap
+        void push(Node* node) 
+        {
+            ALGO_COUNT(heap_pushes);
+            heap.push_back(node);
+            heapifyUp(heap.size() - 1);
+        }
+
+        // Remove and return the top (smallest) element
+        Node* pop() 
+        {
+            if (heap.empty())
+                return nullptr;
+            
+            ALGO_COUNT(heap_pops);
+            Node* top = heap[0];
+            heap[0] = heap.back();
+            heap.pop_back();
+            
+            if (!heap.empty())
+                heapifyDown(0);
+            
+            return top;
+        }
+
+        // Check if the heap is empty
+        bool empty() const 
+        {
+            return heap.empty();
+        }
+
+        // Get the current size of the heap
+        // size_t is an unsigned integer type used for sizes and counts
+        size_t size() const 
+        {
+            return heap.size();
+        }
+};
+
+size_t huffman_scratch_bytes(size_t n_symbols) 
+{
+    // node pool (at most 2n - 1 nodes) and heap slots, plus alignment slack for each block
+    return (2 * n_symbols + 1) * sizeof(Node) + n_symbols * sizeof(Node*) + 2 * alignof(std::max_align_t);
+}
+
+// Build the Huffman tree from frequency data
+Node* buildHuffmanTree(std::span<const int> frequencies, std::pmr::vector<Node>& pool) 
+{
+    pool.clear();
+    pool.reserve(2 * frequencies.size() + 1);
+    BinaryHeap pq(frequencies.size(), pool.get_allocator().resource());
+
+    // Create leaf nodes for each character and add to priority queue
+    for (size_t i = 0; i < frequencies.size(); ++i) 
+    {
+        if (frequencies[i] > 0) 
+        {
+            pool.emplace_back(frequencies[i], char('A' + i));
+            pq.push(&pool.back());
+        }
+    }
+
+    // Build the tree by repeatedly combining the two nodes with lowest frequency
+    while (pq.size() > 1) 
+    {
+        Node* left = pq.pop();
+        Node* right = pq.pop();
+        pool.emplace_back(left->frequency + right->frequency, '\0', left, right);
+        pq.push(&pool.back());
+    }
+
+    return pq.pop();  // Return the root of the Huffman tree
+}
+
+// Function to calculate the total number of bits required
+long long calculateTotalBits(const Node* root, int depth) 
+{
+    if (root == nullptr)
+        return 0;
+    if (root->isLeaf())
+        return (long long)root->frequency * std::max(1, depth);
+    
+    return calculateTotalBits(root->left, depth + 1) + calculateTotalBits(root->right, depth + 1);
+}
+
+long long huffman_total_bits(std::span<const int> frequencies, std::pmr::memory_resource* scratch) 
+{
+    std::pmr::vector<Node> pool(scratch);
+    return calculateTotalBits(buildHuffmanTree(frequencies, pool));
+}
+
+}
@@ -5,209 +5,394 @@
 
 #include <iostream>
 #include <vector>
-#include <limits>
 #include <algorithm>
-#include <numeric>
-
-// Define infinity (i.e max int range in c++) for distances between vertices.
-const int INF = std::numeric_limits<int>::max();
-
-// Structure to represent an edge in the graph 
-struct Edge 
-{
-    int to;
-    int weight;
-
-    Edge(int edge_to, int edge_weight) : to(edge_to), weight(edge_weight) {}
-};
-
-// Structure to represent a node in the priority queue
-struct Node 
+#include <random>
+#include <chrono>
+#include <string>
+#include <span>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "prims_Algorithm.h"
+#include "../common/edge_list_loader.h"
+#include "../common/instrumentation.h"
+
+using namespace prims;
+
+// Row-major n x n int32 weight matrix for dense Prim, either parsed from text into owned
+// storage or mmapped read-only from a binary file. Missing edges are stored as INF.
+class WeightMatrix 
 {
-    int vertex;
-    int distance;
+    private:
+        int n = 0;
+        const int32_t* data = nullptr;
+        std::vector<int32_t> storage;
+        void* mapping = MAP_FAILED;
+        size_t mapping_size = 0;
 
-    Node(int vertex_label, int vertex_distance) : vertex(vertex_label), distance(vertex_distance) {}
-};
+    public:
+        WeightMatrix() = default;
+        WeightMatrix(const WeightMatrix&) = delete;
+        WeightMatrix& operator=(const WeightMatrix&) = delete;
 
-// MinHeap class for efficient priority queue operations
-class MinHeap 
-{
-    private:
-        std::vector<Node> heap;
-        std::vector<int> position;
+        ~WeightMatrix() 
+        {
+            if (mapping != MAP_FAILED)
+                munmap(mapping, mapping_size);
+        }
 
-        // Move a node up the heap to maintain the heap property
-        void heapify_up(int i) 
+        // Text format: n followed by n * n weights row by row; a negative weight means no edge
+        bool load_text(std::istream& input) 
         {
-            while (i > 0) 
+            if (!(input >> n) || n <= 0)
+                return false;
+
+            storage.resize(size_t(n) * n);
+            for (int32_t& weight : storage) 
             {
-                int parent = (i - 1) / 2;
-                if (heap[i].distance >= heap[parent].distance)
-                    break;
-                
-                std::swap(heap[i], heap[parent]);
-                position[heap[i].vertex] = i;
-                position[heap[parent].vertex] = parent;
-                
-                i = parent;
+                if (!(input >> weight))
+                    return false;
+                if (weight < 0)
+                    weight = INF;
             }
+            data = storage.data();
+            return true;
         }
 
-        // Move a node down the heap to maintain the heap property
-        void heapify_down(int i) 
+        // Binary format: int32 n followed by n * n native-endian int32 weights, INT32_MAX meaning no edge.
+        // The file is mapped rather than read so rows are paged in as Prim streams through them.
+        bool map_binary(const char* path) 
         {
-            int heap_size = heap.size();
-            while (true) 
+            int fd = open(path, O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat file_stat;
+            bool ok = fstat(fd, &file_stat) == 0 && size_t(file_stat.st_size) >= sizeof(int32_t);
+            if (ok) 
             {
-                int smallest = i;
-                int left = 2 * i + 1;
-                int right = 2 * i + 2;
-                
-                if (left < heap_size && heap[left].distance < heap[smallest].distance)
-                    smallest = left;
-                
-                if (right < heap_size && heap[right].distance < heap[smallest].distance)
-                    smallest = right;
-                
-                if (smallest == i)
-                    break;
-                
-                std::swap(heap[i], heap[smallest]);
-                position[heap[i].vertex] = i;
-                position[heap[smallest].vertex] = smallest;
-                
-                i = smallest;
+                mapping_size = file_stat.st_size;
+                mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ok = mapping != MAP_FAILED;
             }
+            close(fd);
+            if (!ok)
+                return false;
+
+            madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+            std::memcpy(&n, mapping, sizeof(int32_t));
+            data = static_cast<const int32_t*>(mapping) + 1;
+            return n > 0 && mapping_size >= sizeof(int32_t) * (1 + size_t(n) * n);
         }
 
-    public:
-        MinHeap(int size) : position(size, -1) 
-        {}
+        int size() const 
+        {
+            return n;
+        }
 
-        // Add a new node to the heap
-        void push(const Node& node) 
+        // Whole matrix, row by row, as handed to dense_prim_algorithm
+        std::span<const int32_t> weights() const 
         {
-            heap.push_back(node);
-            position[node.vertex] = heap.size() - 1;
-            heapify_up(heap.size() - 1);
+            return std::span<const int32_t>(data, size_t(n) * n);
         }
+};
 
-        // Remove and return the node with the minimum distance
-        Node pop() 
+    // Generate a random dense graph (edge probability `density`, connected through a
+    // backbone path) and time Prim's algorithm with both heap implementations
+    int run_heap_benchmark(int n_vertices, double density, unsigned seed) 
+    {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> weight_distr(1, 1000000);
+        std::bernoulli_distribution edge_distr(density);
+
+        std::vector<UndirectedEdge> edges;
+        for (int u = 0; u < n_vertices; ++u) 
         {
-            Node root = heap[0];
-            heap[0] = heap.back();
-            heap.pop_back();
-            if (!heap.empty()) 
+            for (int v = u + 1; v < n_vertices; ++v) 
             {
-                position[heap[0].vertex] = 0;
-                heapify_down(0);
+                if (v == u + 1 || edge_distr(gen))
+                    edges.push_back({u, v, weight_distr(gen)});
             }
-            position[root.vertex] = -1;
-            return root;
         }
 
-        // Check if the heap is empty
-        bool empty() const 
+        std::cout << "vertices: " << n_vertices << " edges: " << edges.size() << std::endl;
+        Graph graph(n_vertices, edges, graph_io::default_thread_count());
+
+        auto run = [&](const char* name, HeapKind heap) 
         {
-            return heap.empty();
+            PrimStats stats;
+            auto begin = std::chrono::steady_clock::now();
+            long long total = prim_algorithm(graph.view(), 0, heap, std::pmr::get_default_resource(), &stats);
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+
+            std::cout << name << ": total " << total
+                      << " time_ms " << ms
+                      << " pushes " << stats.pushes
+                      << " pops " << stats.pops
+                      << " decrease_keys " << stats.decrease_keys
+                      << " max_heap_size " << stats.max_heap_size << std::endl;
+        };
+
+        run("binary", HeapKind::binary);
+        run("pairing", HeapKind::pairing);
+        return 0;
+    }
+
+    // Time Prim once, then the streaming mode and Boruvka with 1, 2, 4, ... threads up to max_threads
+    // on the same edges, flagging any total that differs from Prim's; returns false on a mismatch
+    bool compare_mst_modes(const char* name, int n_vertices, const std::vector<UndirectedEdge>& edges, int max_threads) 
+    {
+        std::cout << name << " vertices: " << n_vertices << " edges: " << edges.size() << std::endl;
+
+        Graph graph(n_vertices, edges, max_threads);
+
+        auto begin = std::chrono::steady_clock::now();
+        long long prim_total = prim_algorithm(graph.view(), 0);
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "prim: total " << prim_total
+                  << " time_ms " << std::chrono::duration<double, std::milli>(end - begin).count() << std::endl;
+
+        begin = std::chrono::steady_clock::now();
+        StreamingMST streaming_mst(n_vertices, edges.size() / 8 + 1);
+        for (const UndirectedEdge& edge : edges)
+            streaming_mst.add_edge(edge);
+        long long stream_total = streaming_mst.finish();
+        end = std::chrono::steady_clock::now();
+        std::cout << "stream: total " << stream_total
+                  << " time_ms " << std::chrono::duration<double, std::milli>(end - begin).count()
+                  << (stream_total == prim_total ? "" : " MISMATCH") << std::endl;
+
+        bool all_match = stream_total == prim_total;
+        for (int n_threads = 1; n_threads <= max_threads; n_threads *= 2) 
+        {
+            begin = std::chrono::steady_clock::now();
+            long long total = 0;
+            boruvka_mst(n_vertices, edges, n_threads, total);
+            end = std::chrono::steady_clock::now();
+            std::cout << "boruvka threads " << n_threads << ": total " << total
+                      << " time_ms " << std::chrono::duration<double, std::milli>(end - begin).count()
+                      << (total == prim_total ? "" : " MISMATCH") << std::endl;
+            all_match = all_match && total == prim_total;
         }
-};
+        return all_match;
+    }
 
-// Graph class to represent the graph and implement Prim's algorithm
-class Graph 
-{
-    private:
-        int vertices;
-        std::vector<std::vector<Edge>> adjacency_list;
+    // Generate a random sparse graph with a backbone path so it is connected, and a disconnected one
+    // whose random edges stay inside four vertex blocks (leaving some vertices isolated), then check
+    // every MST mode agrees on both
+    int run_boruvka_benchmark(int n_vertices, int average_degree, unsigned seed, int max_threads) 
+    {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> weight_distr(1, 1000000);
+        std::uniform_int_distribution<int> vertex_distr(0, n_vertices - 1);
+
+        std::vector<UndirectedEdge> edges;
+        long long n_edges = (long long)n_vertices * average_degree / 2;
+        edges.reserve(n_edges + n_vertices);
+        for (int v = 1; v < n_vertices; ++v)
+            edges.push_back({v - 1, v, weight_distr(gen)});
+        for (long long i = 0; i < n_edges; ++i)
+            edges.push_back({vertex_distr(gen), vertex_distr(gen), weight_distr(gen)});
+        bool all_match = compare_mst_modes("connected", n_vertices, edges, max_threads);
+
+        const int n_blocks = 4;
+        int block_size = std::max(1, n_vertices / n_blocks);
+        std::uniform_int_distribution<int> offset_distr(0, block_size - 1);
+        edges.clear();
+        for (long long i = 0; i < n_edges / 4; ++i) 
+        {
+            int block_start = std::min(vertex_distr(gen) / block_size, n_blocks - 1) * block_size;
+            int from = std::min(n_vertices - 1, block_start + offset_distr(gen));
+            int to = std::min(n_vertices - 1, block_start + offset_distr(gen));
+            edges.push_back({from, to, weight_distr(gen)});
+        }
+        all_match = compare_mst_modes("disconnected", n_vertices, edges, max_threads) && all_match;
 
-    public:
+        return all_match ? 0 : 1;
+    }
 
-        Graph(int v) : vertices(v), adjacency_list(v) 
-        {}
+    void print_Usage(const char* program) 
+    {
+        std::cerr << "Usage: " << program << " [binary|pairing] < [graph_file_name.txt]" << std::endl;
+        std::cerr << "       " << program << " boruvka [threads] < [graph_file_name.txt]" << std::endl;
+        std::cerr << "       " << program << " stream [chunk_edges] < [graph_file_name.txt]" << std::endl;
+        std::cerr << "       " << program << " dense < [matrix_file_name.txt]" << std::endl;
+        std::cerr << "       " << program << " dense-bin [matrix_file_name.bin]" << std::endl;
+        std::cerr << "       " << program << " --bench [vertices] [edge_probability] [seed]" << std::endl;
+        std::cerr << "       " << program << " --bench-boruvka [vertices] [average_degree] [seed] [max_threads]" << std::endl;
+    }
+
+    int main(int argc, char* argv[]) 
+    {
+        ALGO_REPORT_ON_EXIT();
+        std::string mode = argc > 1 ? argv[1] : "binary";
 
-        // Add an edge to the graph
-        void add_edge(int from, int to, int weight) 
+        if (mode == "--bench" && argc >= 3) 
         {
-            adjacency_list[from].emplace_back(to, weight);
-            adjacency_list[to].emplace_back(from, weight); // for undirected graph
+            int n_vertices = std::atoi(argv[2]);
+            double density = argc > 3 ? std::atof(argv[3]) : 0.5;
+            unsigned seed = argc > 4 ? std::atoi(argv[4]) : 1;
+            if (n_vertices < 1 || !(density >= 0.0 && density <= 1.0)) 
+            {
+                print_Usage(argv[0]);
+                return 1;
+            }
+            return run_heap_benchmark(n_vertices, density, seed);
         }
 
-        // Implementation of Prim's algorithm to find the Minimum Spanning Tree
-        void prim_algorithm(int start) 
+        // Dense mode takes a weight matrix instead of an edge list
+        if (mode == "dense" || mode == "dense-bin") 
         {
-            std::vector<bool> visited(vertices, false);
-            std::vector<int> parent(vertices, -1);
-            std::vector<int> distances_Vector(vertices, INF);
-
-            // Create a min heap to efficiently get the minimum weight edge
-            MinHeap priority_queue(vertices);
+            ALGO_PHASE("parse");
+            WeightMatrix matrix;
+            bool loaded = (mode == "dense") ? (argc == 2 && matrix.load_text(std::cin)) 
+                                            : (argc == 3 && matrix.map_binary(argv[2]));
+            if (!loaded) 
+            {
+                std::cerr << "Usage: " << argv[0] << " dense < [matrix_file_name.txt]" << std::endl;
+                std::cerr << "       " << argv[0] << " dense-bin [matrix_file_name.bin]" << std::endl;
+                return 1;
+            }
 
-            // Start with the given vertex
-            priority_queue.push(Node(start, 0));
-            distances_Vector[start] = 0;
+            ALGO_PHASE("solve");
+            long long total_tree_length = dense_prim_algorithm(matrix.weights(), matrix.size(), 0);
+            ALGO_PHASE("output");
+            std::cout << total_tree_length << std::endl;
+            return 0;
+        }
 
-            // Main loop of Prim's algorithm
-            while (!priority_queue.empty()) 
+        int hardware_threads = graph_io::default_thread_count();
+        if (mode == "--bench-boruvka" && argc >= 3) 
+        {
+            int n_vertices = std::atoi(argv[2]);
+            int average_degree = argc > 3 ? std::atoi(argv[3]) : 8;
+            unsigned seed = argc > 4 ? std::atoi(argv[4]) : 1;
+            int max_threads = argc > 5 ? std::atoi(argv[5]) : hardware_threads;
+            if (n_vertices < 1 || average_degree < 0) 
             {
+                print_Usage(argv[0]);
+                return 1;
+            }
+            return run_boruvka_benchmark(n_vertices, average_degree, seed, std::max(1, max_threads));
+        }
+
+        bool valid_mode = (mode == "binary" || mode == "pairing") ? argc <= 2 
+                                                                  : ((mode == "boruvka" || mode == "stream") && argc <= 3);
+        if (!valid_mode) 
+        {
+            print_Usage(argv[0]);
+            return 1;
+        }
 
-                // Get the vertex with minimum distance from the priority queue
-                Node current_vertex = priority_queue.pop();
-                int vertex_label = current_vertex.vertex;
+        // Streaming mode reads the edges chunk by chunk and never materialises the whole graph
+        if (mode == "stream") 
+        {
+            // The chunk size must be a positive integer; StreamingMST raises it to at least n_vertices
+            size_t chunk_edges = size_t(1) << 22;
+            if (argc > 2) 
+            {
+                const char* argument_end = argv[2] + std::strlen(argv[2]);
+                auto [parsed_end, parse_error] = std::from_chars(argv[2], argument_end, chunk_edges);
+                if (parse_error != std::errc() || parsed_end != argument_end || chunk_edges == 0) 
+                {
+                    print_Usage(argv[0]);
+                    return 1;
+                }
+            }
 
-                // Mark the vertex as visited
-                visited[vertex_label] = true;
+            ALGO_PHASE("solve");
+            // Same line-based format and checks as load_edge_list, read one line at a time
+            std::string line;
+            int n_vertices = 0;
+            long long n_edges = 0;
+            if (!std::getline(std::cin, line) || !graph_io::parse_line(line.data(), line.data() + line.size(), n_vertices, n_edges) 
+                || n_vertices < 1 || n_edges < 0) 
+            {
+                std::cerr << "Invalid graph input: malformed header, the first line must hold a vertex count of at least 1 and a non-negative edge count" << std::endl;
+                return 1;
+            }
 
-                // Explore all adjacent vertices
-                for (const Edge& edge : adjacency_list[vertex_label]) 
+            StreamingMST streaming_mst(n_vertices, chunk_edges);
+            UndirectedEdge edge;
+            long long n_read = 0;
+            long long line_number = 1;
+            while (n_read < n_edges && std::getline(std::cin, line)) 
+            {
+                ++line_number;
+                const char* line_begin = line.data();
+                const char* line_end = line_begin + line.size();
+                if (graph_io::is_blank_line(line_begin, line_end))
+                    continue;
+                if (!graph_io::parse_line(line_begin, line_end, edge.from, edge.to, edge.weight)) 
                 {
-                    int edge_to = edge.to;
-                    int edge_weight = edge.weight;
-
-                    // If the adjacent vertex is not visited and has a smaller weight
-                    if (!visited[edge_to] && edge_weight < distances_Vector[edge_to]) 
-                    {
-
-                        // Update the parent, distance, and add to priority queue
-                        parent[edge_to] = vertex_label;
-                        distances_Vector[edge_to] = edge_weight;
-                        priority_queue.push(Node(edge_to, distances_Vector[edge_to]));
-                    }
+                    std::cerr << "Invalid graph input: malformed edge line " << line_number << std::endl;
+                    return 1;
                 }
+                if (!graph_io::edge_in_range(edge, n_vertices)) 
+                {
+                    std::cerr << "Invalid graph input: " << graph_io::out_of_range_message(edge, n_vertices) << std::endl;
+                    return 1;
+                }
+                streaming_mst.add_edge(edge);
+                ++n_read;
+            }
+            if (n_read < n_edges) 
+            {
+                std::cerr << "Invalid graph input: expected " << n_edges << " edges, found " << n_read << std::endl;
+                return 1;
             }
 
-            // Calculate and print the total weight of the Minimum Spanning Tree
-            int total_tree_length = std::accumulate(distances_Vector.begin(), distances_Vector.end(), 0);
+            long long total_tree_length = streaming_mst.finish();
+            ALGO_PHASE("output");
             std::cout << total_tree_length << std::endl;
+            return 0;
         }
-    };
 
-    int main(int argc, char* argv[]) 
-    {
-        if (argc != 1) 
+        // Read and validate the whole edge list from standard input, parsing it in parallel
+        ALGO_PHASE("parse");
+        int n_threads = (mode == "boruvka" && argc > 2) ? std::max(1, std::atoi(argv[2])) : hardware_threads;
+        graph_io::EdgeList edge_list;
+        std::string error;
+        if (!graph_io::load_edge_list(0, n_threads, edge_list, error)) 
         {
-            std::cerr << "Usage: " << argv[0] << " < [graph_file_name.txt]" << std::endl;
+            std::cerr << "Invalid graph input: " << error << std::endl;
             return 1;
         }
+        int n_vertices = edge_list.n_vertices;
 
-        // Read the number of vertices and edges
-        int n_vertices, n_edges;
-        std::cin >> n_vertices >> n_edges;
-
-        // Create the graph
-        Graph graph(n_vertices);
-
-        // Read and add edges to the graph
-        for (int i = 0; i < n_edges; ++i) 
+        // Boruvka works straight off the edge list, so skip building the adjacency list
+        if (mode == "boruvka") 
         {
-            int vertex1, vertex2, weight;
-            std::cin >> vertex1 >> vertex2 >> weight;
-            graph.add_edge(vertex1, vertex2, weight);
+            ALGO_PHASE("solve");
+            long long total_tree_length = 0;
+            if (!boruvka_mst(n_vertices, edge_list.edges, n_threads, total_tree_length)) 
+            {
+                std::cerr << "Invalid graph input: boruvka supports at most " << BORUVKA_MAX_EDGES << " edges" << std::endl;
+                return 1;
+            }
+            ALGO_PHASE("output");
+            std::cout << total_tree_length << std::endl;
+            return 0;
         }
 
-        // Run Prim's algorithm starting from vertex 0
-        graph.prim_algorithm(0);
+        // Create the graph
+        ALGO_PHASE("build");
+        Graph graph(n_vertices, edge_list.edges, n_threads);
+        std::vector<UndirectedEdge>().swap(edge_list.edges);
+
+        // Run Prim's algorithm starting from vertex 0 with the selected heap
+        ALGO_PHASE("solve");
+        HeapKind heap = (mode == "pairing") ? HeapKind::pairing : HeapKind::binary;
+        long long total_tree_length = prim_algorithm(graph.view(), 0, heap);
+        ALGO_PHASE("output");
+        std::cout << total_tree_length << std::endl;
 
         return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,239 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Minimum spanning tree engines as a library: Prim with a binary or pairing heap, parallel
+// Boruvka, a streaming semi-external Kruskal and dense O(V^2) Prim. Inputs are std::span views
+// over caller-owned CSR buffers, edge lists or weight matrices, and every temporary is taken from
+// a caller-supplied std::pmr::memory_resource, so a monotonic_buffer_resource over a reused buffer
+// makes a call allocation-free (Boruvka still starts its worker threads). Nothing here prints.
+
+#ifndef PRIMS_ALGORITHM_H
+#define PRIMS_ALGORITHM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "../common/edge_list_loader.h"
+
+namespace prims
+{
+
+// Define infinity (i.e max int range in c++) for distances between vertices.
+const int INF = std::numeric_limits<int>::max();
+
+// Undirected edge as read from the input, used by the edge-list based MST engines
+using UndirectedEdge = graph_io::EdgeRecord;
+
+// Structure to represent an edge in the graph 
+struct Edge 
+{
+    int to;
+    int weight;
+
+    Edge(int edge_to, int edge_weight) : to(edge_to), weight(edge_weight) {}
+};
+
+// Non-owning undirected graph in CSR form: the edges of vertex v (each undirected edge appears
+// under both endpoints) are edges[offsets[v] .. offsets[v + 1]), so offsets holds n_vertices + 1 entries
+struct GraphView 
+{
+    int n_vertices = 0;
+    std::span<const size_t> offsets;
+    std::span<const Edge> edges;
+
+    std::span<const Edge> neighbours(int vertex) const 
+    {
+        return edges.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+    }
+};
+
+// Graph class owning the CSR buffers a GraphView points at
+class Graph 
+{
+    private:
+        int vertices;
+        std::vector<size_t> offsets;
+        std::vector<Edge> edges;
+
+    public:
+
+        // Build the adjacency from an undirected edge list (each edge stored in both directions)
+        Graph(int v, const std::vector<UndirectedEdge>& edge_list, int n_threads = 1) : vertices(v) 
+        {
+            graph_io::build_csr(vertices, edge_list, true, n_threads, offsets, edges);
+        }
+
+        GraphView view() const 
+        {
+            return GraphView{vertices, offsets, edges};
+        }
+};
+
+// Priority queue used by prim_algorithm
+enum class HeapKind 
+{
+    binary,
+    pairing
+};
+
+// Heap operation counts collected by prim_algorithm for benchmarking
+struct PrimStats 
+{
+    long long pushes = 0;
+    long long pops = 0;
+    long long decrease_keys = 0;
+    size_t max_heap_size = 0;
+};
+
+// Upper bound on the scratch bytes one prim_algorithm call needs on n_vertices vertices
+size_t prim_scratch_bytes(int n_vertices, HeapKind heap);
+
+// Implementation of Prim's algorithm to find the Minimum Spanning Tree.
+// Returns the total weight of the minimum spanning forest, growing the first tree from start;
+// stats collects heap operation counts when given.
+long long prim_algorithm(GraphView graph, int start, HeapKind heap = HeapKind::binary, 
+                         std::pmr::memory_resource* scratch = std::pmr::get_default_resource(), PrimStats* stats = nullptr);
+
+// Boruvka packs each edge index into 32 bits, so one run takes at most this many edges. The last
+// index is left out because weight INF at index 2^32 - 1 would pack to the all-ones "no edge" marker.
+const size_t BORUVKA_MAX_EDGES = (size_t(1) << 32) - 1;
+
+// Parallel Boruvka over an edge list with n_threads workers. Stores the minimum spanning forest
+// weight in total_tree_length, or returns false when edges has more than BORUVKA_MAX_EDGES entries.
+bool boruvka_mst(int n_vertices, std::span<const UndirectedEdge> edges, int n_threads, long long& total_tree_length, 
+                 std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+// O(V^2) Prim over a row-major n x n weight matrix in which INF marks a missing edge;
+// returns the minimum spanning forest weight
+long long dense_prim_algorithm(std::span<const int32_t> matrix, int n, int start, 
+                               std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+// Sequential union-find with path halving and union by size, reset between streaming batches
+class UnionFind 
+{
+    private:
+        std::pmr::vector<int> parent;
+        std::pmr::vector<int> set_size;
+
+    public:
+        UnionFind(int size, std::pmr::memory_resource* scratch = std::pmr::get_default_resource()) : parent(size, scratch), set_size(size, 1, scratch) 
+        {
+            std::iota(parent.begin(), parent.end(), 0);
+        }
+
+        int find(int x) 
+        {
+            while (parent[x] != x) 
+            {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        }
+
+        bool unite(int a, int b) 
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return false;
+            if (set_size[a] < set_size[b])
+                std::swap(a, b);
+            parent[b] = a;
+            set_size[a] += set_size[b];
+            return true;
+        }
+
+        // Restore the singleton sets for the given vertices only, keeping the reset O(touched)
+        void reset(std::span<const UndirectedEdge> touched) 
+        {
+            for (const UndirectedEdge& edge : touched) 
+            {
+                parent[edge.from] = edge.from;
+                parent[edge.to] = edge.to;
+                set_size[edge.from] = set_size[edge.to] = 1;
+            }
+        }
+};
+
+// Semi-external MST over an edge stream: only the current spanning forest (at most V - 1 edges)
+// and one chunk of incoming edges are held in memory. Each full chunk is merged with the forest
+// by Kruskal; by the cycle property an edge dropped from the MST of a subgraph can never be in
+// the MST of the whole graph, so the heaviest edge on every cycle is evicted as soon as it appears.
+// Memory is two buffers of V + chunk_edges edges plus the union-find, regardless of how many
+// edges the stream holds. Each merge costs O(forest + chunk) on top of sorting the chunk, so the
+// chunk must hold at least V edges for the per-edge cost to stay amortised O(log chunk); the
+// constructor raises smaller chunks to V.
+class StreamingMST 
+{
+    private:
+        size_t chunk_edges;
+        size_t forest_size = 0;
+        std::pmr::vector<UndirectedEdge> buffer;     // current forest followed by the pending chunk
+        std::pmr::vector<UndirectedEdge> merged;     // merge target, swapped with buffer after each merge
+        UnionFind components;
+
+        // Kruskal over forest + chunk; whatever survives becomes the new forest
+        void merge_chunk() 
+        {
+            // The forest is kept sorted by weight, so only the new chunk needs sorting before the merge
+            auto by_weight = [](const UndirectedEdge& a, const UndirectedEdge& b) 
+            {
+                return a.weight < b.weight;
+            };
+            // std::inplace_merge would take its temporary buffer from global operator new, so merge
+            // into the second scratch buffer instead and swap the two
+            std::sort(buffer.begin() + forest_size, buffer.end(), by_weight);
+            merged.resize(buffer.size());
+            std::merge(buffer.begin(), buffer.begin() + forest_size, buffer.begin() + forest_size, buffer.end(), merged.begin(), by_weight);
+
+            auto forest_end = std::remove_if(merged.begin(), merged.end(), [&](const UndirectedEdge& edge) 
+            {
+                return !components.unite(edge.from, edge.to);
+            });
+            merged.erase(forest_end, merged.end());
+            components.reset(merged);
+            buffer.swap(merged);
+            forest_size = buffer.size();
+        }
+
+    public:
+        // Forest, pending chunk, merge target and union-find all come from scratch, sized once here
+        StreamingMST(int n_vertices, size_t chunk, std::pmr::memory_resource* scratch = std::pmr::get_default_resource()) 
+            : chunk_edges(std::max<size_t>({chunk, size_t(n_vertices), 1})), buffer(scratch), merged(scratch), components(n_vertices, scratch) 
+        {
+            buffer.reserve(chunk_edges + n_vertices);
+            merged.reserve(chunk_edges + n_vertices);
+        }
+
+        // Append one edge, merging the pending chunk into the forest once it is full
+        void add_edge(const UndirectedEdge& edge) 
+        {
+            buffer.push_back(edge);
+            if (buffer.size() - forest_size >= chunk_edges)
+                merge_chunk();
+        }
+
+        // Merge any remaining edges and return the total weight of the minimum spanning forest
+        long long finish() 
+        {
+            merge_chunk();
+
+            long long total_tree_length = 0;
+            for (const UndirectedEdge& edge : buffer)
+                total_tree_length += edge.weight;
+            return total_tree_length;
+        }
+};
+
+}
+
+#endif
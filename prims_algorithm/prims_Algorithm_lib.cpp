@@ -0,0 +1,613 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// The AVX2 key scan is compiled with a per-function target attribute and picked at run time,
+// so plain builds still get it on CPUs that support it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PRIMS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include "prims_Algorithm.h"
+#include "../common/instrumentation.h"
+
+namespace prims
+{
+
+using graph_io::parallel_for;
+
+// Structure to represent a node in the priority queue
+struct Node 
+{
+    int vertex;
+    int distance;
+
+    Node(int vertex_label, int vertex_distance) : vertex(vertex_label), distance(vertex_distance) {}
+};
+
+// MinHeap class for efficient priority queue operations
+class MinHeap 
+{
+    private:
+        std::pmr::vector<Node> heap;
+        std::pmr::vector<int> position;
+
+        // Move a node up the heap to maintain the heap property
+        void heapify_up(int i) 
+        {
+            while (i > 0) 
+            {
+                ALGO_COUNT(heap_sift_up_steps);
+                int parent = (i - 1) / 2;
+                if (heap[i].distance >= heap[parent].distance)
+                    break;
+                
+                std::swap(heap[i], heap[parent]);
+                position[heap[i].vertex] = i;
+                position[heap[parent].vertex] = parent;
+                
+                i = parent;
+            }
+        }
+
+        // Move a node down the heap to maintain the heap property
+        void heapify_down(int i) 
+        {
+            int heap_size = heap.size();
+            while (true) 
+            {
+                ALGO_COUNT(heap_sift_down_steps);
+                int smallest = i;
+                int left = 2 * i + 1;
+                int right = 2 * i + 2;
+                
+                if (left < heap_size && heap[left].distance < heap[smallest].distance)
+                    smallest = left;
+                
+                if (right < heap_size && heap[right].distance < heap[smallest].distance)
+                    smallest = right;
+                
+                if (smallest == i)
+                    break;
+                
+                std::swap(heap[i], heap[smallest]);
+                position[heap[i].vertex] = i;
+                position[heap[smallest].vertex] = smallest;
+                
+                i = smallest;
+            }
+        }
+
+    public:
+        // All storage, sized for every vertex at once, comes from scratch
+        MinHeap(int size, std::pmr::memory_resource* scratch) : heap(scratch), position(size, -1, scratch) 
+        {
+            heap.reserve(size);
+        }
+
+        // Add a new node to the heap
+        void push(const Node& node) 
+        {
+            ALGO_COUNT(heap_pushes);
+            heap.push_back(node);
+            position[node.vertex] = heap.size() - 1;
+            heapify_up(heap.size() - 1);
+        }
+
+        // Remove and return the node with the minimum distance
+        Node pop() 
+        {
+            ALGO_COUNT(heap_pops);
+            Node root = heap[0];
+            heap[0] = heap.back();
+            heap.pop_back();
+            if (!heap.empty()) 
+            {
+                position[heap[0].vertex] = 0;
+                heapify_down(0);
+            }
+            position[root.vertex] = -1;
+            return root;
+        }
+
+        // Lower the distance of a vertex already in the heap, or insert it if absent,
+        // so every vertex occupies at most one slot and the heap never exceeds V entries
+        void decrease_key(int vertex, int new_distance) 
+        {
+            int i = position[vertex];
+            if (i == -1) 
+            {
+                push(Node(vertex, new_distance));
+            } 
+            else if (new_distance < heap[i].distance) 
+            {
+                ALGO_COUNT(heap_decrease_keys);
+                heap[i].distance = new_distance;
+                heapify_up(i);
+            }
+        }
+
+        // Check if the heap is empty
+        bool empty() const 
+        {
+            return heap.empty();
+        }
+
+        // Get the current number of entries in the heap
+        size_t size() const 
+        {
+            return heap.size();
+        }
+};
+
+// Pairing heap over a fixed pool of V vertex slots, offering O(1) push and
+// decrease-key (amortised o(log n)) as an alternative to the binary MinHeap
+class PairingHeap 
+{
+    private:
+        std::pmr::vector<int> key;
+        std::pmr::vector<int> child;
+        std::pmr::vector<int> sibling;
+        std::pmr::vector<int> prev;      // left sibling, or parent for a leftmost child
+        std::pmr::vector<bool> in_heap;
+        std::pmr::vector<int> merge_buffer;
+        int root = -1;
+        size_t count = 0;
+
+        // Link two detached trees, making the larger root the first child of the smaller one
+        int meld(int a, int b) 
+        {
+            if (a == -1)
+                return b;
+            if (b == -1)
+                return a;
+
+            ALGO_COUNT(heap_link_steps);
+            if (key[b] < key[a])
+                std::swap(a, b);
+
+            sibling[b] = child[a];
+            if (child[a] != -1)
+                prev[child[a]] = b;
+            prev[b] = a;
+            child[a] = b;
+            return a;
+        }
+
+        // Detach a non-root node (and its subtree) from its parent and siblings
+        void cut(int v) 
+        {
+            int p = prev[v];
+            if (child[p] == v)
+                child[p] = sibling[v];
+            else
+                sibling[p] = sibling[v];
+
+            if (sibling[v] != -1)
+                prev[sibling[v]] = p;
+
+            sibling[v] = -1;
+            prev[v] = -1;
+        }
+
+        // Standard two-pass merge: meld siblings pairwise left to right, then fold right to left
+        int merge_pairs(int first) 
+        {
+            merge_buffer.clear();
+            while (first != -1) 
+            {
+                int a = first;
+                int b = sibling[a];
+                first = (b != -1) ? sibling[b] : -1;
+
+                sibling[a] = prev[a] = -1;
+                if (b != -1)
+                    sibling[b] = prev[b] = -1;
+
+                merge_buffer.push_back(meld(a, b));
+            }
+
+            int result = -1;
+            for (auto it = merge_buffer.rbegin(); it != merge_buffer.rend(); ++it)
+                result = meld(*it, result);
+            return result;
+        }
+
+    public:
+        // All storage, sized for every vertex at once, comes from scratch
+        PairingHeap(int size, std::pmr::memory_resource* scratch) 
+            : key(size, INF, scratch), child(size, -1, scratch), sibling(size, -1, scratch), prev(size, -1, scratch), 
+              in_heap(size, false, scratch), merge_buffer(scratch) 
+        {
+            merge_buffer.reserve(size);
+        }
+
+        // Add a new node to the heap
+        void push(const Node& node) 
+        {
+            ALGO_COUNT(heap_pushes);
+            int v = node.vertex;
+            key[v] = node.distance;
+            child[v] = sibling[v] = prev[v] = -1;
+            in_heap[v] = true;
+            root = meld(root, v);
+            ++count;
+        }
+
+        // Remove and return the node with the minimum distance
+        Node pop() 
+        {
+            ALGO_COUNT(heap_pops);
+            int top = root;
+            root = merge_pairs(child[top]);
+            child[top] = -1;
+            in_heap[top] = false;
+            --count;
+            return Node(top, key[top]);
+        }
+
+        // Lower the distance of a vertex already in the heap, or insert it if absent
+        void decrease_key(int vertex, int new_distance) 
+        {
+            if (!in_heap[vertex]) 
+            {
+                push(Node(vertex, new_distance));
+            } 
+            else if (new_distance < key[vertex]) 
+            {
+                ALGO_COUNT(heap_decrease_keys);
+                key[vertex] = new_distance;
+                if (vertex != root) 
+                {
+                    cut(vertex);
+                    root = meld(root, vertex);
+                }
+            }
+        }
+
+        // Check if the heap is empty
+        bool empty() const 
+        {
+            return root == -1;
+        }
+
+        // Get the current number of entries in the heap
+        size_t size() const 
+        {
+            return count;
+        }
+};
+
+// Implementation of Prim's algorithm to find the Minimum Spanning Tree.
+// HeapType is MinHeap or PairingHeap; returns the total weight of the minimum spanning forest.
+template <typename HeapType>
+long long prim_algorithm(GraphView graph, int start, std::pmr::memory_resource* scratch, PrimStats* stats) 
+{
+    int vertices = graph.n_vertices;
+    std::pmr::vector<bool> visited(vertices, false, scratch);
+    std::pmr::vector<int> parent(vertices, -1, scratch);
+    std::pmr::vector<int> distances_Vector(vertices, INF, scratch);
+
+    // Create a min heap to efficiently get the minimum weight edge
+    HeapType priority_queue(vertices, scratch);
+
+    // Grow a tree from start, then from every vertex still outside the forest, so disconnected
+    // input gives the minimum spanning forest just like Boruvka and the streaming mode
+    int next_root = 0;
+    for (int root = start; root < vertices; root = next_root) 
+    {
+        priority_queue.push(Node(root, 0));
+        distances_Vector[root] = 0;
+        if (stats)
+            ++stats->pushes;
+
+        // Main loop of Prim's algorithm
+        while (!priority_queue.empty()) 
+        {
+            if (stats)
+                stats->max_heap_size = std::max(stats->max_heap_size, priority_queue.size());
+
+            // Get the vertex with minimum distance from the priority queue
+            Node current_vertex = priority_queue.pop();
+            int vertex_label = current_vertex.vertex;
+            if (stats)
+                ++stats->pops;
+
+            // Mark the vertex as visited
+            visited[vertex_label] = true;
+
+            // Explore all adjacent vertices
+            for (const Edge& edge : graph.neighbours(vertex_label)) 
+            {
+                int edge_to = edge.to;
+                int edge_weight = edge.weight;
+
+                // If the adjacent vertex is not visited and has a smaller weight
+                if (!visited[edge_to] && edge_weight < distances_Vector[edge_to]) 
+                {
+                    if (stats)
+                        ++(distances_Vector[edge_to] == INF ? stats->pushes : stats->decrease_keys);
+
+                    // Update the parent and distance, then lower its key (or insert it) in the queue
+                    parent[edge_to] = vertex_label;
+                    distances_Vector[edge_to] = edge_weight;
+                    priority_queue.decrease_key(edge_to, edge_weight);
+                }
+            }
+        }
+
+        while (next_root < vertices && visited[next_root])
+            ++next_root;
+    }
+
+    // Calculate the total weight of the Minimum Spanning Forest
+    return std::accumulate(distances_Vector.begin(), distances_Vector.end(), 0LL);
+}
+
+size_t prim_scratch_bytes(int n_vertices, HeapKind heap) 
+{
+    // visited flags, parent and distance arrays, then the heap's own per-vertex arrays,
+    // with alignment slack for every block
+    size_t heap_bytes = (heap == HeapKind::binary) ? sizeof(Node) + sizeof(int) : 5 * sizeof(int) + 1;
+    return size_t(n_vertices) * (2 * sizeof(int) + 1 + heap_bytes) + 10 * alignof(std::max_align_t);
+}
+
+long long prim_algorithm(GraphView graph, int start, HeapKind heap, std::pmr::memory_resource* scratch, PrimStats* stats) 
+{
+    if (heap == HeapKind::pairing)
+        return prim_algorithm<PairingHeap>(graph, start, scratch, stats);
+    return prim_algorithm<MinHeap>(graph, start, scratch, stats);
+}
+
+// Lock-free union-find: find() compresses paths by halving, unite() links roots with a CAS
+// so concurrent unions of disjoint sets from different threads never lose an update
+class ConcurrentUnionFind 
+{
+    private:
+        std::pmr::vector<std::atomic<int>> parent;
+
+    public:
+        ConcurrentUnionFind(int size, std::pmr::memory_resource* scratch) : parent(size, scratch) 
+        {
+            for (int i = 0; i < size; ++i)
+                parent[i].store(i, std::memory_order_relaxed);
+        }
+
+        int find(int x) 
+        {
+            while (true) 
+            {
+                int p = parent[x].load(std::memory_order_acquire);
+                if (p == x)
+                    return x;
+
+                int grandparent = parent[p].load(std::memory_order_acquire);
+                if (p != grandparent)
+                    parent[x].compare_exchange_weak(p, grandparent, std::memory_order_acq_rel);
+                x = grandparent;
+            }
+        }
+
+        // Merge the sets containing a and b; returns false if they were already joined
+        bool unite(int a, int b) 
+        {
+            while (true) 
+            {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                    return false;
+
+                // Always hang the larger root under the smaller one so links cannot form cycles
+                if (a < b)
+                    std::swap(a, b);
+
+                int expected = a;
+                if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                    return true;
+            }
+        }
+};
+
+// Parallel Boruvka: every round each thread scans a slice of the surviving edges and records
+// the cheapest edge leaving each component with an atomic min, the chosen edges are contracted
+// through the concurrent union-find, and edges that became internal are compacted away.
+// Stores the total weight of the minimum spanning forest in total_tree_length.
+bool boruvka_mst(int n_vertices, std::span<const UndirectedEdge> input_edges, int n_threads, long long& total_tree_length, std::pmr::memory_resource* scratch) 
+{
+    const uint64_t NO_EDGE = std::numeric_limits<uint64_t>::max();
+    if (input_edges.size() > BORUVKA_MAX_EDGES)
+        return false;
+
+    // The working edge list shrinks every round, so both buffers are sized once for the input
+    ConcurrentUnionFind components(n_vertices, scratch);
+    std::pmr::vector<std::atomic<uint64_t>> cheapest(n_vertices, scratch);
+    std::pmr::vector<UndirectedEdge> edges(input_edges.begin(), input_edges.end(), scratch);
+    std::pmr::vector<UndirectedEdge> survivors(scratch);
+    std::pmr::vector<size_t> thread_counts(n_threads, scratch);
+    std::pmr::vector<long long> thread_weights(n_threads, scratch);
+    std::pmr::vector<size_t> offsets(n_threads + 1, scratch);
+    survivors.reserve(edges.size());
+    total_tree_length = 0;
+
+    while (!edges.empty()) 
+    {
+        parallel_for(n_threads, n_vertices, [&](size_t begin, size_t end, int) 
+        {
+            for (size_t v = begin; v < end; ++v)
+                cheapest[v].store(NO_EDGE, std::memory_order_relaxed);
+        });
+
+        // Pack (weight, edge index) into one word so ties break by index and the chosen set stays acyclic;
+        // the low 32 bits hold the index, hence the BORUVKA_MAX_EDGES check above
+        parallel_for(n_threads, edges.size(), [&](size_t begin, size_t end, int) 
+        {
+            for (size_t i = begin; i < end; ++i) 
+            {
+                int root_from = components.find(edges[i].from);
+                int root_to = components.find(edges[i].to);
+                if (root_from == root_to)
+                    continue;
+
+                uint64_t packed = (uint64_t(uint32_t(edges[i].weight) ^ 0x80000000u) << 32) | i;
+                for (int root : {root_from, root_to}) 
+                {
+                    uint64_t current = cheapest[root].load(std::memory_order_relaxed);
+                    while (packed < current && !cheapest[root].compare_exchange_weak(current, packed, std::memory_order_relaxed))
+                    {}
+                }
+            }
+        });
+
+        // Contract the selected edges; an edge chosen by both of its endpoints is only counted once
+        std::fill(thread_weights.begin(), thread_weights.end(), 0);
+        parallel_for(n_threads, n_vertices, [&](size_t begin, size_t end, int thread_id) 
+        {
+            for (size_t v = begin; v < end; ++v) 
+            {
+                uint64_t packed = cheapest[v].load(std::memory_order_relaxed);
+                if (packed == NO_EDGE)
+                    continue;
+
+                const UndirectedEdge& edge = edges[packed & 0xffffffffu];
+                if (components.unite(edge.from, edge.to))
+                    thread_weights[thread_id] += edge.weight;
+            }
+        });
+        total_tree_length = std::accumulate(thread_weights.begin(), thread_weights.end(), total_tree_length);
+
+        // Compact the edge list: count survivors per slice, prefix-sum the counts, then copy in place
+        std::fill(thread_counts.begin(), thread_counts.end(), 0);
+        parallel_for(n_threads, edges.size(), [&](size_t begin, size_t end, int thread_id) 
+        {
+            size_t kept = 0;
+            for (size_t i = begin; i < end; ++i)
+                kept += components.find(edges[i].from) != components.find(edges[i].to);
+            thread_counts[thread_id] = kept;
+        });
+
+        offsets[0] = 0;
+        for (int t = 0; t < n_threads; ++t)
+            offsets[t + 1] = offsets[t] + thread_counts[t];
+
+        survivors.resize(offsets[n_threads]);
+        parallel_for(n_threads, edges.size(), [&](size_t begin, size_t end, int thread_id) 
+        {
+            size_t out = offsets[thread_id];
+            for (size_t i = begin; i < end; ++i) 
+            {
+                if (components.find(edges[i].from) != components.find(edges[i].to))
+                    survivors[out++] = edges[i];
+            }
+        });
+        edges.swap(survivors);
+    }
+
+    return true;
+}
+
+// Index of the smallest key in key[begin, n), given the best key and index found before begin
+// (first one on ties)
+int min_key_index_scalar(const int32_t* key, int n, int begin, int best, int32_t best_key) 
+{
+    for (int i = begin; i < n; ++i) 
+    {
+        if (key[i] < best_key) 
+        {
+            best_key = key[i];
+            best = i;
+        }
+    }
+    return best;
+}
+
+#ifdef PRIMS_AVX2_DISPATCH
+// AVX2 keeps eight running minima and their indices in vector registers and reduces them once
+// at the end; the scalar scan finishes the last n % 8 keys
+__attribute__((target("avx2"))) int min_key_index_avx2(const int32_t* key, int n) 
+{
+    __m256i min_keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+    __m256i min_indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i indices = min_indices;
+    const __m256i step = _mm256_set1_epi32(8);
+
+    int i = 8;
+    for (; i + 8 <= n; i += 8) 
+    {
+        indices = _mm256_add_epi32(indices, step);
+        __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + i));
+        __m256i smaller = _mm256_cmpgt_epi32(min_keys, keys);
+        min_keys = _mm256_min_epi32(min_keys, keys);
+        min_indices = _mm256_blendv_epi8(min_indices, indices, smaller);
+    }
+
+    alignas(32) int32_t lane_keys[8];
+    alignas(32) int32_t lane_indices[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane_keys), min_keys);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lane_indices), min_indices);
+
+    int32_t best_key = lane_keys[0];
+    int best = lane_indices[0];
+    for (int lane = 1; lane < 8; ++lane) 
+    {
+        if (lane_keys[lane] < best_key || (lane_keys[lane] == best_key && lane_indices[lane] < best)) 
+        {
+            best_key = lane_keys[lane];
+            best = lane_indices[lane];
+        }
+    }
+    return min_key_index_scalar(key, n, i, best, best_key);
+}
+#endif
+
+// Index of the smallest key (first one on ties), using the AVX2 scan when the CPU has it
+int min_key_index(const int32_t* key, int n) 
+{
+#ifdef PRIMS_AVX2_DISPATCH
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2 && n >= 8)
+        return min_key_index_avx2(key, n);
+#endif
+    return min_key_index_scalar(key, n, 1, 0, key[0]);
+}
+
+// O(V^2) Prim for dense graphs: keys live in one contiguous int32 array, the next vertex is
+// found by a linear min scan, and keys are relaxed against one matrix row per step. Tree
+// vertices are pinned at INF through a floor mask (INF for tree vertices, INT32_MIN otherwise)
+// so the row update is a branch-free min/max the compiler can vectorise. Disconnected input
+// gives the minimum spanning forest.
+long long dense_prim_algorithm(std::span<const int32_t> matrix, int n, int start, std::pmr::memory_resource* scratch) 
+{
+    std::pmr::vector<int32_t> key(n, INF, scratch);
+    std::pmr::vector<int32_t> key_floor(n, std::numeric_limits<int32_t>::min(), scratch);
+    long long total_tree_length = 0;
+
+    key[start] = 0;
+    for (int step = 0; step < n; ++step) 
+    {
+        int v = min_key_index(key.data(), n);
+        if (key[v] == INF) 
+        {
+            // The current tree is complete; start the next one at the first vertex outside the forest
+            v = std::find(key_floor.begin(), key_floor.end(), std::numeric_limits<int32_t>::min()) - key_floor.begin();
+            key[v] = 0;
+        }
+
+        total_tree_length += key[v];
+        key_floor[v] = INF;
+        key[v] = INF;
+
+        const int32_t* row = matrix.data() + size_t(v) * n;
+        for (int j = 0; j < n; ++j)
+            key[j] = std::max(std::min(key[j], row[j]), key_floor[j]);
+    }
+    return total_tree_length;
+}
+
+}
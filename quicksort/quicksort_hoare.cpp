@@ -3,12 +3,17 @@
     B-number: B01044448
 */
 
-#include <random>
 #include <iostream>
 #include <vector>
 #include <iomanip>
 #include <fstream>
 
+#include "quicksort_hoare.h"
+#include "../common/instrumentation.h"
+
+
+namespace quicksort
+{
 
 void printArray(const std::vector<int>& arr, int start_idx, int end_idx) {
 
@@ -69,100 +74,9 @@ ReadFileReturnValue readFile() {
     return {arr, n};
 }
 
-int random_number_generator(int low, int high){
-
-    /*
-        Description:
-            Generates a random number between low and high.
-
-        Returns:
-            num: (int) - random index number between low and high.
-    */
-
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distr(low, high+1);
-    int num = distr(gen);
-    return num;
-}
-
-
-int partition(std::vector<int>& arr, int low, int high){
-
-    /*
-        Description:
-            - This function chooses a pivot randomly and partitions the array segment [low, high]
-                such that elements smaller than the pivot are on the left side and larger elements
-                are on the right side. The pivot itself can be anywhere in the partitioned array.
-            - Uses random pivot selection to avoid worst-case scenarios on already sorted arrays.
-            - Implements two-way partitioning for better performance on arrays with many duplicates.
-            - The returned index is used to divide the array for subsequent recursive calls.
-
-        Args:
-            arr: (vector<int>) - array of int data type
-            low: (int) - lower bound of the array
-            high: (int) - upper bound of the array
-
-        Returns:
-            j: (int) - index where the partition ends (last index of the left subarray).
-    */
-
-    if (low >= high) {
-        return low;
-    }
-
-    int pivotIndex = random_number_generator(low, high);
-    int pivot = arr[pivotIndex];
-
-	int i = low-1;
-	int j = high+1;
-
-	while (true) {
-
-		do{
-			i++;
-		} while(arr[i]<pivot);
-
-		do{
-			j--;
-		} while(arr[j]>pivot);
-
-		if(i>=j){
-			return j;
-		}
-
-		std::swap(arr[i], arr[j]);
-	}
 }
 
-void quickSort(std::vector<int>& arr, int low, int high){
-
-    /*
-        Description:
-            - This function recursively divides the array into smaller subarrays, partitions them, and
-                sorts them.
-            - The algorithm works as follows:
-                1. Partition the subarray.
-                2. Recursively sort the left subarray.
-                3. Recursively sort the right subarray.
-            - The base case low < high (subarrays less that 0 or 1 element) requires no sorting.
-
-        Returns:
-            Void
-    */
-
-    if(low<high){
-        
-    	int pi = partition(arr, low, high);
-    	
-        // Recursively call quickSort for the left subarray.
-        quickSort(arr, low, pi);
-
-        // Recursively call quickSort for the right subarray.
-    	quickSort(arr, pi+1, high);
-
-    }
-}
+using namespace quicksort;
 
 int main(int argc, char *argv[]){
 
@@ -180,6 +94,8 @@ int main(int argc, char *argv[]){
     */
 
    
+    ALGO_REPORT_ON_EXIT();
+    ALGO_PHASE("parse");
     ReadFileReturnValue readFileReturnValue = readFile();
     int n = readFileReturnValue.n;
     std::vector<int> arr = readFileReturnValue.arr;
@@ -200,8 +116,10 @@ int main(int argc, char *argv[]){
         return 0;
     }
         
+    ALGO_PHASE("solve");
     quickSort(arr, 0, n-1);
 
+    ALGO_PHASE("output");
     std::cout << "Sorted array is: \n";
     std::cout << end_idx-start_idx << std::endl;
     printArray(arr, start_idx, end_idx);
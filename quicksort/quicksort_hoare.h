@@ -0,0 +1,31 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+// Randomised Hoare-partition quicksort as a library. Every entry point works in place on a
+// caller-owned std::span, so sorting never allocates and never prints.
+
+#ifndef QUICKSORT_HOARE_H
+#define QUICKSORT_HOARE_H
+
+#include <span>
+
+namespace quicksort
+{
+
+// Random index in [low, high] used to pick the pivot
+int random_number_generator(int low, int high);
+
+// Hoare partition of arr[low..high]; returns the last index of the left part
+int partition(std::span<int> arr, int low, int high);
+
+// Sort arr[low..high] in place
+void quickSort(std::span<int> arr, int low, int high);
+
+// Sort the whole span in place
+void sort(std::span<int> arr);
+
+}
+
+#endif
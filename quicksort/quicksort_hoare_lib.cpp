@@ -0,0 +1,128 @@
+/*
+    Name: Nilesh Rajiv Auradkar
+    B-number: B01044448
+*/
+
+#include <random>
+
+#include "quicksort_hoare.h"
+#include "../common/instrumentation.h"
+
+
+namespace quicksort
+{
+
+int random_number_generator(int low, int high){
+
+    /*
+        Description:
+            Generates a random number between low and high.
+
+        Returns:
+            num: (int) - random index number between low and high.
+    */
+
+    // seed the engine once; constructing a random_device on every call dominated the sort
+    static thread_local std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<> distr(low, high);
+    int num = distr(gen);
+    return num;
+}
+
+
+int partition(std::span<int> arr, int low, int high){
+
+    /*
+        Description:
+            - This function chooses a pivot randomly and partitions the array segment [low, high]
+                such that elements smaller than the pivot are on the left side and larger elements
+                are on the right side. The pivot itself can be anywhere in the partitioned array.
+            - Uses random pivot selection to avoid worst-case scenarios on already sorted arrays.
+            - Implements two-way partitioning for better performance on arrays with many duplicates.
+            - The returned index is used to divide the array for subsequent recursive calls.
+
+        Args:
+            arr: (span<int>) - caller-owned array of int data type
+            low: (int) - lower bound of the array
+            high: (int) - upper bound of the array
+
+        Returns:
+            j: (int) - index where the partition ends (last index of the left subarray).
+    */
+
+    if (low >= high) {
+        return low;
+    }
+
+    int pivotIndex = random_number_generator(low, high);
+    int pivot = arr[pivotIndex];
+
+	int i = low-1;
+	int j = high+1;
+
+	while (true) {
+
+		do{
+			i++;
+			ALGO_COUNT(partition_comparisons);
+		} while(arr[i]<pivot);
+
+		do{
+			j--;
+			ALGO_COUNT(partition_comparisons);
+		} while(arr[j]>pivot);
+
+		if(i>=j){
+			return j;
+		}
+
+		ALGO_COUNT(partition_swaps);
+		std::swap(arr[i], arr[j]);
+	}
+}
+
+void quickSort(std::span<int> arr, int low, int high){
+
+    /*
+        Description:
+            - This function recursively divides the array into smaller subarrays, partitions them, and
+                sorts them.
+            - The algorithm works as follows:
+                1. Partition the subarray.
+                2. Recursively sort the left subarray.
+                3. Recursively sort the right subarray.
+            - The base case low < high (subarrays less that 0 or 1 element) requires no sorting.
+
+        Returns:
+            Void
+    */
+
+    if(low<high){
+        
+    	int pi = partition(arr, low, high);
+    	
+        // Recursively call quickSort for the left subarray.
+        quickSort(arr, low, pi);
+
+        // Recursively call quickSort for the right subarray.
+    	quickSort(arr, pi+1, high);
+
+    }
+}
+
+void sort(std::span<int> arr){
+
+    /*
+        Description:
+            Sorts the whole caller-owned span in place. Nothing is allocated or printed.
+
+        Returns:
+            Void
+    */
+
+    if (!arr.empty()) {
+        quickSort(arr, 0, int(arr.size()) - 1);
+    }
+}
+
+}